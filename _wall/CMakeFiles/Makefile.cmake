@@ -0,0 +1,80 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/constructor.dir/DependInfo.cmake"
+  "CMakeFiles/vector.dir/DependInfo.cmake"
+  "CMakeFiles/map.dir/DependInfo.cmake"
+  "CMakeFiles/stl_algorithm.dir/DependInfo.cmake"
+  "CMakeFiles/soa.dir/DependInfo.cmake"
+  "CMakeFiles/indirect.dir/DependInfo.cmake"
+  "CMakeFiles/pipeline.dir/DependInfo.cmake"
+  "CMakeFiles/generator.dir/DependInfo.cmake"
+  "CMakeFiles/cursor.dir/DependInfo.cmake"
+  "CMakeFiles/paged.dir/DependInfo.cmake"
+  "CMakeFiles/poly.dir/DependInfo.cmake"
+  "CMakeFiles/invoke.dir/DependInfo.cmake"
+  "CMakeFiles/parallel.dir/DependInfo.cmake"
+  "CMakeFiles/deque.dir/DependInfo.cmake"
+  "CMakeFiles/keyed.dir/DependInfo.cmake"
+  "CMakeFiles/join.dir/DependInfo.cmake"
+  "CMakeFiles/dirty.dir/DependInfo.cmake"
+  "CMakeFiles/sparse.dir/DependInfo.cmake"
+  "CMakeFiles/variant.dir/DependInfo.cmake"
+  "CMakeFiles/snapshot.dir/DependInfo.cmake"
+  "CMakeFiles/concurrent.dir/DependInfo.cmake"
+  "CMakeFiles/merge.dir/DependInfo.cmake"
+  "CMakeFiles/inserter.dir/DependInfo.cmake"
+  "CMakeFiles/stride.dir/DependInfo.cmake"
+  "CMakeFiles/cache.dir/DependInfo.cmake"
+  "CMakeFiles/rcu.dir/DependInfo.cmake"
+  "CMakeFiles/engine_benchmark.dir/DependInfo.cmake"
+  )
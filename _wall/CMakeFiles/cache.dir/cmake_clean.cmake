@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cache.dir/cache_driver.cpp.o"
+  "CMakeFiles/cache.dir/cache_driver.cpp.o.d"
+  "cache"
+  "cache.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cache.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/concurrent.dir/concurrent_driver.cpp.o"
+  "CMakeFiles/concurrent.dir/concurrent_driver.cpp.o.d"
+  "concurrent"
+  "concurrent.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/concurrent.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
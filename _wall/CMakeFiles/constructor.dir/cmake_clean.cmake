@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/constructor.dir/constructor_driver.cpp.o"
+  "CMakeFiles/constructor.dir/constructor_driver.cpp.o.d"
+  "constructor"
+  "constructor.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/constructor.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cursor.dir/cursor_driver.cpp.o"
+  "CMakeFiles/cursor.dir/cursor_driver.cpp.o.d"
+  "cursor"
+  "cursor.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cursor.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
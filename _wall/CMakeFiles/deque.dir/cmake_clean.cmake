@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/deque.dir/deque_driver.cpp.o"
+  "CMakeFiles/deque.dir/deque_driver.cpp.o.d"
+  "deque"
+  "deque.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/deque.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
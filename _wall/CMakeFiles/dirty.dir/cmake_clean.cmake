@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dirty.dir/dirty_driver.cpp.o"
+  "CMakeFiles/dirty.dir/dirty_driver.cpp.o.d"
+  "dirty"
+  "dirty.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dirty.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
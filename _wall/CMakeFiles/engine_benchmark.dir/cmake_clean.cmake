@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/engine_benchmark.dir/engine_benchmark.cpp.o"
+  "CMakeFiles/engine_benchmark.dir/engine_benchmark.cpp.o.d"
+  "engine_benchmark"
+  "engine_benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/engine_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
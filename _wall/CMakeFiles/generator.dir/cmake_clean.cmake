@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/generator.dir/generator_driver.cpp.o"
+  "CMakeFiles/generator.dir/generator_driver.cpp.o.d"
+  "generator"
+  "generator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/generator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
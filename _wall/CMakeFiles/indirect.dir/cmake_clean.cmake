@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/indirect.dir/indirect_driver.cpp.o"
+  "CMakeFiles/indirect.dir/indirect_driver.cpp.o.d"
+  "indirect"
+  "indirect.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/indirect.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/inserter.dir/inserter_driver.cpp.o"
+  "CMakeFiles/inserter.dir/inserter_driver.cpp.o.d"
+  "inserter"
+  "inserter.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/inserter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
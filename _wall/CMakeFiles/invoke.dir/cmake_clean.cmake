@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/invoke.dir/invoke_driver.cpp.o"
+  "CMakeFiles/invoke.dir/invoke_driver.cpp.o.d"
+  "invoke"
+  "invoke.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/invoke.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/keyed.dir/keyed_driver.cpp.o"
+  "CMakeFiles/keyed.dir/keyed_driver.cpp.o.d"
+  "keyed"
+  "keyed.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/keyed.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
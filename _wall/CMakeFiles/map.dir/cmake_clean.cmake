@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/map.dir/map_driver.cpp.o"
+  "CMakeFiles/map.dir/map_driver.cpp.o.d"
+  "map"
+  "map.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/map.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
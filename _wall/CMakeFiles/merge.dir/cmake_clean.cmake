@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/merge.dir/merge_driver.cpp.o"
+  "CMakeFiles/merge.dir/merge_driver.cpp.o.d"
+  "merge"
+  "merge.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/merge.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/paged.dir/paged_driver.cpp.o"
+  "CMakeFiles/paged.dir/paged_driver.cpp.o.d"
+  "paged"
+  "paged.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/paged.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
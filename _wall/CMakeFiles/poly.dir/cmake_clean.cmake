@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/poly.dir/poly_driver.cpp.o"
+  "CMakeFiles/poly.dir/poly_driver.cpp.o.d"
+  "poly"
+  "poly.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/poly.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rcu.dir/rcu_driver.cpp.o"
+  "CMakeFiles/rcu.dir/rcu_driver.cpp.o.d"
+  "rcu"
+  "rcu.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/rcu.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/snapshot.dir/snapshot_driver.cpp.o"
+  "CMakeFiles/snapshot.dir/snapshot_driver.cpp.o.d"
+  "snapshot"
+  "snapshot.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/snapshot.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
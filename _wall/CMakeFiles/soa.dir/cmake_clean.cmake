@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/soa.dir/soa_driver.cpp.o"
+  "CMakeFiles/soa.dir/soa_driver.cpp.o.d"
+  "soa"
+  "soa.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/soa.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
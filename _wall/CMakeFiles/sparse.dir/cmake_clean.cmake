@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sparse.dir/sparse_driver.cpp.o"
+  "CMakeFiles/sparse.dir/sparse_driver.cpp.o.d"
+  "sparse"
+  "sparse.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sparse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/stl_algorithm.dir/algorithm_driver.cpp.o"
+  "CMakeFiles/stl_algorithm.dir/algorithm_driver.cpp.o.d"
+  "stl_algorithm"
+  "stl_algorithm.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/stl_algorithm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/stride.dir/stride_driver.cpp.o"
+  "CMakeFiles/stride.dir/stride_driver.cpp.o.d"
+  "stride"
+  "stride.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/stride.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
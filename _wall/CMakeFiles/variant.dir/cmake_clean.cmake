@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/variant.dir/variant_driver.cpp.o"
+  "CMakeFiles/variant.dir/variant_driver.cpp.o.d"
+  "variant"
+  "variant.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/variant.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
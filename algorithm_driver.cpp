@@ -8,10 +8,68 @@
 #include <iostream>
 #include <deque>
 #include <algorithm>
+#include <cstdlib>
+#include <new>
+#include <numeric>
 #include <random>
 
 #include "iterator.h"
 #include "base.h"
+#include "benchmark.h"
+
+/*!
+ * The number of heap allocations made so far
+ */
+static long allocations = 0;
+
+/*!
+ * Counts every heap allocation
+ * @param size The number of bytes to allocate
+ * @return The memory
+ */
+void *operator new(std::size_t size) {
+
+	++allocations;
+	if (void *memory = std::malloc(size ? size : 1)) {
+		return memory;
+	}
+	throw std::bad_alloc();
+}
+
+/*!
+ * Frees memory from the counting operator new
+ * @param memory The memory to free
+ */
+void operator delete(void *memory) noexcept {
+
+	std::free(memory);
+}
+
+/*!
+ * Frees memory from the counting operator new
+ * @param memory The memory to free
+ */
+void operator delete(void *memory, std::size_t) noexcept {
+
+	std::free(memory);
+}
+
+/*!
+ * Times a function and counts the heap allocations of its fastest run
+ * @param name The name to report
+ * @param elements The number of elements the function visits
+ * @param function The function to time
+ */
+template<typename F>
+void Measure(const std::string &name, double elements, F function) {
+
+	const long before = allocations;
+	function();
+	const long made = allocations - before;
+	const double time = Benchmark(5, function);
+	Report(name, time, elements, elements * sizeof(derived1));
+	std::cout << "    " << made << " allocations" << std::endl;
+}
 
 /*!
  * Tests the uses of the iterator classes with
@@ -35,20 +93,75 @@ int main() {
 	Iterator<base> list_back  = MakeIterator<base>(vector.end());
 
 	// Print the list using the iterators
-	std::for_each(list_front, list_back, [](const base &rhs) {
+	for_each(list_front, list_back, [](const base &rhs) {
 		std::cout << rhs;
 	});
 	std::cout << std::endl;
 
 	// Find the smallest element
-	auto min = std::min_element(list_front, list_back);
+	Iterator<base> min = min_element(list_front, list_back);
 	std::cout << *min << std::endl;
 
 	// Print again, starting from the smallest element
-	std::for_each(min, list_back, [](const base &rhs) {
+	for_each(min, list_back, [](const base &rhs) {
 		std::cout << dynamic_cast<const derived1&>(rhs);
 	});
 	std::cout << std::endl;
 
+	// Benchmarking the standard algorithms against the overloads //
+	std::deque<derived1> large;
+	for (int i = 0; i < 1 << 20; ++i) {
+		large.emplace_back(static_cast<float>(i % 1000));
+	}
+	const Iterator<base> large_begin = MakeIterator<base>(large.begin());
+	const Iterator<base> large_end = MakeIterator<base>(large.end());
+	const auto elements = static_cast<double>(large.size());
+	const auto by_float = [](const base &lhs, const base &rhs) {
+		return lhs.getfloat() < rhs.getfloat();
+	};
+	const auto add = [](float sum, const base &rhs) {
+		return sum + rhs.getfloat();
+	};
+	float results[4] = {};
+
+	Measure("std::min_element", elements, [&]() {
+		results[0] = std::min_element(large_begin, large_end, by_float)->getfloat();
+	});
+	Measure("min_element", elements, [&]() {
+		results[1] = min_element(large_begin, large_end, by_float)->getfloat();
+	});
+	Measure("std::accumulate", elements, [&]() {
+		results[2] = std::accumulate(large_begin, large_end, 0.f, add);
+	});
+	Measure("accumulate", elements, [&]() {
+		results[3] = accumulate(large_begin, large_end, 0.f, add);
+	});
+	KeepAlive(results[0] + results[2]);
+	if (results[0] != results[1] || results[2] != results[3]) {
+		std::cout << "Results do not match" << std::endl;
+		return 1;
+	}
+
+	// The worst case for min_element, every element is a new smallest one //
+	std::deque<derived1> descending;
+	for (int i = 0; i < 1 << 20; ++i) {
+		descending.emplace_back(static_cast<float>((1 << 20) - i));
+	}
+	const Iterator<base> descending_begin = MakeIterator<base>(descending.begin());
+	const Iterator<base> descending_end = MakeIterator<base>(descending.end());
+	Measure("std::min_element descending", elements, [&]() {
+		results[0] = std::min_element(descending_begin, descending_end, by_float)->getfloat();
+	});
+	Measure("min_element descending", elements, [&]() {
+		results[1] = min_element(descending_begin, descending_end, by_float)->getfloat();
+	});
+	const long before = allocations;
+	const float smallest = min_element(descending_begin, descending_end, by_float)->getfloat();
+	const long made = allocations - before;
+	if (results[0] != 1.f || results[1] != 1.f || smallest != 1.f || made > 1) {
+		std::cout << "Descending results do not match" << std::endl;
+		return 1;
+	}
+
 	return 0;
 }
\ No newline at end of file
@@ -71,6 +71,14 @@ protected:
 	 */
 	base() : _baseint(number++) {
 	}
+
+	/*!
+	 * Constructor for objects that stand in for an existing object,
+	 * such as a view into a structure-of-arrays container
+	 * @param id The number id of the object being stood in for
+	 */
+	explicit base(int id) : _baseint(id) {
+	}
 };
 
 /*!
@@ -205,6 +213,60 @@ public:
 
 };
 
+/*!
+ * A final derived class that does not print, for benchmarks
+ */
+class derived4 final : public base
+{
+	/*!
+	 * The number returned by getfloat()
+	 */
+	float _number;
+	/*!
+	 * The number of times doNothing() was called
+	 */
+	int   _calls;
+public:
+	/*!
+	 * Conversion constructor for derived4
+	 * @param number the number to store in _number
+	 */
+	derived4(float number) : base(), _number(number), _calls(0) {
+	}
+
+	/*!
+	 * Gets the number set during construction
+	 * @return _number value
+	 */
+	float getfloat() const override {
+
+		return _number;
+	}
+
+	/*!
+	 * Counts the call instead of printing
+	 */
+	void doNothing() override {
+
+		++_calls;
+	}
+
+	/*!
+	 * Really does nothing (const)
+	 */
+	void doSomething() const override {
+	}
+
+	/*!
+	 * Gets the number of times doNothing() was called
+	 * @return _calls value
+	 */
+	int getCalls() const {
+
+		return _calls;
+	}
+};
+
 int base::number;
 
 /*!
@@ -0,0 +1,72 @@
+/*!
+ * @file benchmark.h
+ * @author Saadiq Daniels
+ * @date 18/10/2026
+ * @version 1.0
+ * @brief
+ * 	A small timing helper shared by the benchmark drivers
+ */
+
+#ifndef TEMPL_ITERATOR_BENCHMARK_H
+#define TEMPL_ITERATOR_BENCHMARK_H
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+/*!
+ * @brief Stops the optimizer from throwing away the result of a benchmark
+ */
+template<typename T>
+void KeepAlive(const T &value) {
+
+#if defined(__GNUC__)
+	// An empty asm statement that claims to read the value and all of memory
+	asm volatile("" : : "g"(&value) : "memory");
+#else
+	static volatile T sink;
+	sink = value;
+	static_cast<void>(sink);
+#endif
+}
+
+/*!
+ * @brief Times a function, keeping the best of a few runs
+ * @tparam F The function type (can be deduced)
+ * @param runs The number of times to call the function
+ * @param function The function to time
+ * @return The fastest run, in seconds
+ */
+template<typename F>
+double Benchmark(int runs, F function) {
+
+	double best = 0.0;
+	for (int i = 0; i < runs; ++i) {
+		auto start = std::chrono::steady_clock::now();
+		function();
+		std::chrono::duration<double> time = std::chrono::steady_clock::now() - start;
+		if (i == 0 || time.count() < best) {
+			best = time.count();
+		}
+	}
+	return best;
+}
+
+/*!
+ * @brief Prints one line of benchmark results
+ * @param name The name of the benchmark
+ * @param seconds The time one run took
+ * @param elements The number of elements touched by one run
+ * @param bytes The number of bytes read by one run
+ */
+inline void Report(const std::string &name, double seconds, double elements, double bytes) {
+
+	std::cout << std::left << std::setw(40) << name
+	          << std::right << std::fixed << std::setprecision(3)
+	          << std::setw(10) << seconds * 1000.0 << " ms"
+	          << std::setw(10) << elements / seconds / 1e6 << " M/s"
+	          << std::setw(10) << bytes / seconds / 1e6 << " MB/s" << std::endl;
+}
+
+#endif //TEMPL_ITERATOR_BENCHMARK_H
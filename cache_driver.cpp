@@ -0,0 +1,92 @@
+/*!
+ * @file cache_driver.cpp
+ * @author Saadiq Daniels
+ * @date 18/10/2026
+ * @version 1.0
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <map>
+#include <random>
+#include <vector>
+
+#include "iterator.h"
+#include "iterator_cache.h"
+#include "base.h"
+#include "benchmark.h"
+
+/*!
+ * Adds up the floats of a range
+ * @param range The range to walk
+ * @return The sum
+ */
+float Sum(const Range<const base> &range) {
+
+	float sum = 0.f;
+	ForEach(range, [&sum](const base &rhs) {
+		sum += rhs.getfloat();
+	});
+	return sum;
+}
+
+/*!
+ * Tests walking a std::map through a cache of its element addresses
+ * @return 0, or 1 if the cache and the map do not agree
+ */
+int main() {
+
+	// Creating data //
+
+	// Keys inserted in a random order, so the nodes are scattered in key order
+	const int count = 1 << 20;
+	std::vector<int> keys(count);
+	for (int i = 0; i < count; ++i) {
+		keys[i] = i;
+	}
+	std::shuffle(keys.begin(), keys.end(), std::mt19937(42));
+	std::map<int, derived4> derived4_map;
+	for (int key : keys) {
+		derived4_map.emplace(key, derived4(static_cast<float>(key % 100)));
+	}
+	// Added to on every insert or erase
+	std::size_t generation = 0;
+
+	// Benchmarking //
+
+	IterationCache<const base> cache;
+	float sums[4] = {};
+	double time = Benchmark(5, [&]() {
+		sums[0] = Sum(MakeRangeRight<const base>(derived4_map));
+	});
+	Report("map, ForEach over the nodes", time, count, count * sizeof(derived4));
+
+	time = Benchmark(5, [&]() {
+		cache.Invalidate();
+		sums[1] = Sum(cache.Over(MakeRangeRight<const base>(derived4_map), generation));
+	});
+	Report("map, rebuild the cache and walk it", time, count, count * sizeof(derived4));
+
+	time = Benchmark(5, [&]() {
+		sums[2] = Sum(cache.Over(MakeRangeRight<const base>(derived4_map), generation));
+	});
+	Report("map, walk the cached addresses", time, count, count * sizeof(derived4));
+
+	// Inserting moves to a new generation, and the next walk sees the new element
+	derived4_map.emplace(count, derived4(1000.f));
+	++generation;
+	const bool stale = cache.Current(generation);
+	sums[3] = Sum(cache.Over(MakeRangeRight<const base>(derived4_map), generation));
+
+	KeepAlive(sums[0] + sums[1] + sums[2] + sums[3]);
+	std::cout << "Sums: " << sums[0] << " " << sums[1] << " " << sums[2] << " " << sums[3]
+	          << ", cached " << cache.Size() << " of " << derived4_map.size() << std::endl;
+	if (sums[0] != sums[1] || sums[0] != sums[2] || stale || cache.Size() != derived4_map.size() ||
+	    sums[3] != Sum(MakeRangeRight<const base>(derived4_map))) {
+		std::cout << "Cache does not match the map" << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
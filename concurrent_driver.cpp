@@ -0,0 +1,158 @@
+/*!
+ * @file concurrent_driver.cpp
+ * @author Saadiq Daniels
+ * @date 18/10/2026
+ * @version 1.0
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "iterator.h"
+#include "concurrent_vector.h"
+#include "base.h"
+#include "benchmark.h"
+
+/*!
+ * Tests appending to a ConcurrentVector from several threads while other
+ * threads walk it through Iterator<const base>, then measures appends and walks
+ * @return 0, or 1 if a reader saw something it should not have
+ */
+int main() {
+
+	// Copies of these are appended, so that the threads do not all bump base's id counter
+	std::vector<derived4> prototypes;
+	for (int i = 0; i < 100; ++i) {
+		prototypes.emplace_back(static_cast<float>(i));
+	}
+
+	// Stress test //
+
+	const std::size_t producers = 4;
+	const std::size_t readers = 2;
+	const std::size_t each = 1 << 18;
+	ConcurrentVector<derived4> derived4_concurrent;
+	std::atomic<bool> done(false);
+	std::atomic<std::size_t> errors(0);
+	std::atomic<std::size_t> walks(0);
+
+	std::vector<std::thread> threads;
+	for (std::size_t p = 0; p < producers; ++p) {
+		threads.emplace_back([&derived4_concurrent, &prototypes, each]() {
+			for (std::size_t i = 0; i < each; ++i) {
+				derived4_concurrent.emplace_back(prototypes[i % 100]);
+			}
+		});
+	}
+	for (std::size_t r = 0; r < readers; ++r) {
+		threads.emplace_back([&]() {
+			std::size_t previous = 0;
+			while (!done.load(std::memory_order_acquire)) {
+				// Each walk sees a prefix at least as long as the one before, all of it constructed
+				const Range<const base> range = MakeRange<const base>(derived4_concurrent);
+				std::size_t seen = 0;
+				ForEach(range, [&seen, &errors](const base &rhs) {
+					const float number = rhs.getfloat();
+					if (number < 0.f || number >= 100.f) {
+						++errors;
+					}
+					++seen;
+				});
+				if (seen < previous) {
+					++errors;
+				}
+				previous = seen;
+				++walks;
+			}
+		});
+	}
+	for (std::size_t p = 0; p < producers; ++p) {
+		threads[p].join();
+	}
+	done.store(true, std::memory_order_release);
+	for (std::size_t r = producers; r < threads.size(); ++r) {
+		threads[r].join();
+	}
+
+	// Every producer appended each prototype the same number of times
+	double sum = 0.0;
+	ForEach(MakeRange<const base>(derived4_concurrent), [&sum](const base &rhs) {
+		sum += rhs.getfloat();
+	});
+	const double expected = producers * (each / 100 * 4950.0 + ((each % 100) * ((each % 100) - 1)) / 2.0);
+	std::cout << "Derived4_Concurrent: " << derived4_concurrent.size() << " elements, " << walks << " walks during "
+	          << "appends, " << errors << " errors" << std::endl;
+	if (errors || derived4_concurrent.size() != producers * each || sum != expected) {
+		std::cout << "Stress test failed" << std::endl;
+		return 1;
+	}
+
+	// Benchmarking //
+
+	const std::size_t count = 1 << 20;
+	double time = Benchmark(3, [&]() {
+		std::vector<derived4> appended;
+		std::mutex lock;
+		for (std::size_t i = 0; i < count; ++i) {
+			std::lock_guard<std::mutex> guard(lock);
+			appended.push_back(prototypes[i % 100]);
+		}
+		KeepAlive(appended.size());
+	});
+	Report("std::vector push_back under a mutex", time, count, count * sizeof(derived4));
+
+	time = Benchmark(3, [&]() {
+		ConcurrentVector<derived4> appended;
+		for (std::size_t i = 0; i < count; ++i) {
+			appended.emplace_back(prototypes[i % 100]);
+		}
+		KeepAlive(appended.size());
+	});
+	Report("ConcurrentVector emplace_back", time, count, count * sizeof(derived4));
+
+	time = Benchmark(3, [&]() {
+		ConcurrentVector<derived4> appended;
+		std::vector<std::thread> appenders;
+		for (std::size_t p = 0; p < producers; ++p) {
+			appenders.emplace_back([&appended, &prototypes, count, producers]() {
+				for (std::size_t i = 0; i < count / producers; ++i) {
+					appended.emplace_back(prototypes[i % 100]);
+				}
+			});
+		}
+		for (std::thread &appender : appenders) {
+			appender.join();
+		}
+		KeepAlive(appended.size());
+	});
+	Report("ConcurrentVector emplace_back, 4 threads", time, count, count * sizeof(derived4));
+
+	std::vector<derived4> derived4_vector(derived4_concurrent.begin(), derived4_concurrent.end());
+	const Range<const base> ranges[] = {MakeRange<const base>(derived4_vector),
+	                                    MakeRange<const base>(derived4_concurrent)};
+	const char *names[] = {"std::vector ForEach", "ConcurrentVector ForEach"};
+	double sums[2] = {};
+	for (int c = 0; c < 2; ++c) {
+		const std::size_t size = derived4_vector.size();
+		time = Benchmark(5, [&]() {
+			double total = 0.0;
+			ForEach(ranges[c], [&total](const base &rhs) {
+				total += rhs.getfloat();
+			});
+			sums[c] = total;
+		});
+		Report(names[c], time, size, size * sizeof(derived4));
+	}
+
+	KeepAlive(sums[0] + sums[1]);
+	if (sums[0] != sums[1] || sums[1] != sum) {
+		std::cout << "Sums do not match" << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
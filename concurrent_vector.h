@@ -0,0 +1,578 @@
+/*!
+ * @file concurrent_vector.h
+ * @author Saadiq Daniels
+ * @date 18/10/2026
+ * @version 1.0
+ * @brief
+ * 	An append only vector made of segments that never move, which threads
+ * 	can append to while other threads iterate over it without locks
+ */
+
+#ifndef TEMPL_ITERATOR_CONCURRENT_VECTOR_H
+#define TEMPL_ITERATOR_CONCURRENT_VECTOR_H
+
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "iterator.h"
+
+// The number of elements in the first segment, each segment after it is
+// twice the size of the one before (must be a power of two)
+#ifndef CONCURRENT_VECTOR_FIRST_SEGMENT
+#define CONCURRENT_VECTOR_FIRST_SEGMENT 1024
+#endif
+
+/*!
+ * @brief Finds the segment an index falls in and how far into it the index is
+ * @param index The index of an element
+ * @param offset Set to the index of the element inside its segment
+ * @return The segment number
+ */
+inline std::size_t SegmentOf(std::size_t index, std::size_t &offset) noexcept(true) {
+
+	static_assert((CONCURRENT_VECTOR_FIRST_SEGMENT & (CONCURRENT_VECTOR_FIRST_SEGMENT - 1)) == 0,
+	              "CONCURRENT_VECTOR_FIRST_SEGMENT must be a power of two");
+	// Segment k starts at FIRST * (2^k - 1)
+	const std::size_t scaled = index / CONCURRENT_VECTOR_FIRST_SEGMENT + 1;
+	std::size_t segment = 0;
+#if defined(__GNUC__)
+	segment = sizeof(unsigned long long) * 8 - 1 - static_cast<std::size_t>(__builtin_clzll(scaled));
+#else
+	while (scaled >> (segment + 1)) {
+		++segment;
+	}
+#endif
+	offset = index - CONCURRENT_VECTOR_FIRST_SEGMENT * ((std::size_t(1) << segment) - 1);
+	return segment;
+}
+
+template<typename V>
+class ConcurrentVector;
+
+/*!
+ * @brief Walks a ConcurrentVector
+ * @tparam E The element type, const for a const vector
+ */
+template<typename E>
+class ConcurrentIterator
+{
+public:
+	// User friendly names for data types
+	using iterator_category = std::random_access_iterator_tag;
+	using value_type = std::remove_const_t<E>;
+	using difference_type = long;
+	using pointer = E *;
+	using reference = E &;
+	using container_type = std::conditional_t<std::is_const<E>::value,
+			const ConcurrentVector<value_type>, ConcurrentVector<value_type>>;
+
+private:
+	// The vector being iterated over
+	container_type *_owner;
+	// The index of the current element
+	std::size_t    _index;
+	// The current element, or nullptr if its segment does not exist yet
+	pointer        _element;
+	// The end of the current element's segment
+	pointer        _limit;
+
+	/*!
+	 * @brief Finds the current element's segment
+	 */
+	void Locate() noexcept(true) {
+
+		std::size_t offset;
+		const std::size_t segment = SegmentOf(_index, offset);
+		pointer first = _owner->Segment(segment);
+		_element = first ? first + offset : nullptr;
+		_limit = first ? first + _owner->SegmentSize(segment) : nullptr;
+	}
+
+public:
+
+	/*!
+	 * @brief Conversion constructor
+	 * @param owner The vector to iterate over
+	 * @param index The index of the first element
+	 */
+	ConcurrentIterator(container_type &owner, std::size_t index) noexcept(true) : _owner(&owner), _index(index) {
+
+		Locate();
+	}
+
+	/*!
+	 * @brief Dereference operator
+	 * @return A reference to the current element
+	 */
+	reference operator*() const noexcept(true) {
+
+		return *_element;
+	}
+
+	/*!
+	 * @brief Arrow operator
+	 * @return A pointer to the current element
+	 */
+	pointer operator->() const noexcept(true) {
+
+		return _element;
+	}
+
+	/*!
+	 * @brief Increment operator
+	 * @return A reference to this iterator
+	 */
+	ConcurrentIterator &operator++() noexcept(true) {
+
+		++_index;
+		if (++_element == _limit) {
+			Locate();
+		}
+		return *this;
+	}
+
+	/*!
+	 * @brief Decrement operator
+	 * @return A reference to this iterator
+	 */
+	ConcurrentIterator &operator--() noexcept(true) {
+
+		--_index;
+		Locate();
+		return *this;
+	}
+
+	/*!
+	 * @brief Moves the iterator forward or back
+	 * @param count The number of elements to move
+	 * @return A reference to this iterator
+	 */
+	ConcurrentIterator &operator+=(difference_type count) noexcept(true) {
+
+		_index += count;
+		Locate();
+		return *this;
+	}
+
+	/*!
+	 * @brief Difference operator
+	 * @param rhs The iterator to measure from
+	 * @return The number of elements from rhs to this iterator
+	 */
+	difference_type operator-(const ConcurrentIterator &rhs) const noexcept(true) {
+
+		return static_cast<difference_type>(_index) - static_cast<difference_type>(rhs._index);
+	}
+
+	/*!
+	 * @brief Equality operator
+	 * @param rhs The iterator to compare with
+	 * @return True if both iterators point at the same element
+	 */
+	bool operator==(const ConcurrentIterator &rhs) const noexcept(true) {
+
+		return _index == rhs._index;
+	}
+
+	/*!
+	 * @brief Inequality operator
+	 * @param rhs The iterator to compare with
+	 * @return False if both iterators point at the same element
+	 */
+	bool operator!=(const ConcurrentIterator &rhs) const noexcept(true) {
+
+		return _index != rhs._index;
+	}
+
+	/*!
+	 * @brief Gets the number of elements from here to the end of the segment or to last
+	 * @param last The iterator to stop at
+	 * @return The number of elements that are stored one after another from here
+	 */
+	std::size_t Run(const ConcurrentIterator &last) const noexcept(true) {
+
+		const auto segment = static_cast<std::size_t>(_limit - _element);
+		const std::size_t left = last._index - _index;
+		return segment < left ? segment : left;
+	}
+};
+
+/*!
+ * @brief An append only vector that can be iterated over while it grows
+ * @details
+ *      The elements are kept in segments that double in size, and a segment
+ *      is never moved or freed while the vector exists, so pointers and
+ *      iterators stay valid through appends. emplace_back can be called
+ *      from many threads at once without locks, and no append waits for
+ *      another. An element becomes visible to readers once every element
+ *      before it has been constructed, so size(), and end() which reads it,
+ *      always cover a fully constructed prefix. Elements are never removed
+ *      or changed by the vector.
+ * @tparam V The element type
+ */
+template<typename V>
+class ConcurrentVector
+{
+	friend class ConcurrentIterator<V>;
+
+	friend class ConcurrentIterator<const V>;
+
+	// Enough segments to cover every index
+	static constexpr std::size_t segment_count = sizeof(std::size_t) * 8;
+
+public:
+	// User friendly names for data types
+	using value_type = V;
+	using size_type = std::size_t;
+	using iterator = ConcurrentIterator<V>;
+	using const_iterator = ConcurrentIterator<const V>;
+
+private:
+	// The segments, null until the first element in them is appended
+	std::atomic<V *>         _segments[segment_count];
+	// The number of indices handed out to appending threads
+	std::atomic<std::size_t> _reserved;
+	// The number of elements readers can see
+	std::atomic<std::size_t> _size;
+
+	/*!
+	 * @brief Gets the number of elements a segment holds
+	 * @param segment The segment number
+	 * @return The number of elements
+	 */
+	static size_type SegmentSize(std::size_t segment) noexcept(true) {
+
+		return size_type(CONCURRENT_VECTOR_FIRST_SEGMENT) << segment;
+	}
+
+	/*!
+	 * @brief Gets a segment
+	 * @param segment The segment number
+	 * @return The segment's first element, or nullptr if it has not been made
+	 */
+	V *Segment(std::size_t segment) const noexcept(true) {
+
+		return segment < segment_count ? _segments[segment].load(std::memory_order_acquire) : nullptr;
+	}
+
+	/*!
+	 * @brief Gets the flags that say which elements of a segment are constructed
+	 * @param first The segment's first element
+	 * @param segment The segment number
+	 * @return The first flag, the flags are stored after the elements
+	 */
+	static std::atomic<unsigned char> *Flags(V *first, std::size_t segment) noexcept(true) {
+
+		return reinterpret_cast<std::atomic<unsigned char> *>(first + SegmentSize(segment));
+	}
+
+	/*!
+	 * @brief Gets a segment, making it if no thread has yet
+	 * @param segment The segment number
+	 * @return The segment's first element
+	 */
+	V *Grow(std::size_t segment) {
+
+		V *first = _segments[segment].load(std::memory_order_acquire);
+		if (first) {
+			return first;
+		}
+		const size_type size = SegmentSize(segment);
+		auto *made = static_cast<V *>(::operator new(size * sizeof(V) + size, std::align_val_t(alignof(V))));
+		std::atomic<unsigned char> *flags = Flags(made, segment);
+		for (size_type i = 0; i < size; ++i) {
+			new(flags + i) std::atomic<unsigned char>(0);
+		}
+		// Another thread may have made it first
+		if (_segments[segment].compare_exchange_strong(first, made, std::memory_order_acq_rel)) {
+			return made;
+		}
+		::operator delete(made, std::align_val_t(alignof(V)));
+		return first;
+	}
+
+	/*!
+	 * @brief Checks if an element has been constructed
+	 * @param index The index of the element
+	 * @return True if the element's flag is set
+	 */
+	bool Constructed(size_type index) const noexcept(true) {
+
+		std::size_t offset;
+		const std::size_t segment = SegmentOf(index, offset);
+		V *first = Segment(segment);
+		return first && Flags(first, segment)[offset].load();
+	}
+
+	/*!
+	 * @brief Moves the size past every constructed element that follows it
+	 * @details
+	 *      Whichever thread finishes the element the size is waiting on moves
+	 *      it on, so no thread waits for another. The flags and the size use
+	 *      sequentially consistent operations, so of two threads finishing
+	 *      neighbouring elements at once, at least one sees both.
+	 */
+	void Publish() noexcept(true) {
+
+		size_type size = _size.load();
+		for (;;) {
+			const size_type reserved = _reserved.load();
+			size_type ready = size;
+			while (ready < reserved && Constructed(ready)) {
+				++ready;
+			}
+			if (ready == size) {
+				return;
+			}
+			// On failure size is reloaded and the scan starts again from there
+			_size.compare_exchange_weak(size, ready);
+		}
+	}
+
+public:
+
+	/*!
+	 * @brief Default constructor, no segments are made until the first append
+	 */
+	ConcurrentVector() noexcept(true) : _reserved(0), _size(0) {
+
+		for (std::atomic<V *> &segment : _segments) {
+			segment.store(nullptr, std::memory_order_relaxed);
+		}
+	}
+
+	/*!
+	 * @brief The segments belong to this vector
+	 */
+	ConcurrentVector(const ConcurrentVector &) = delete;
+
+	/*!
+	 * @brief The segments belong to this vector
+	 */
+	ConcurrentVector &operator=(const ConcurrentVector &) = delete;
+
+	/*!
+	 * @brief Destructor, must not run while other threads use the vector
+	 */
+	~ConcurrentVector() {
+
+		const size_type size = _size.load(std::memory_order_acquire);
+		for (std::size_t segment = 0; segment < segment_count; ++segment) {
+			V *first = _segments[segment].load(std::memory_order_relaxed);
+			if (!first) {
+				continue;
+			}
+			const size_type start = CONCURRENT_VECTOR_FIRST_SEGMENT * ((size_type(1) << segment) - 1);
+			for (size_type i = 0; start + i < size && i < SegmentSize(segment); ++i) {
+				first[i].~V();
+			}
+			::operator delete(first, std::align_val_t(alignof(V)));
+		}
+	}
+
+	/*!
+	 * @brief Appends an element, can be called from many threads at once
+	 * @tparam Args The constructor argument types (can be deduced)
+	 * @param args The arguments to construct the element with
+	 * @return The index of the new element
+	 */
+	template<typename... Args>
+	size_type emplace_back(Args &&... args) {
+
+		const size_type index = _reserved.fetch_add(1, std::memory_order_relaxed);
+		std::size_t offset;
+		const std::size_t segment = SegmentOf(index, offset);
+		V *first = Grow(segment);
+		new(first + offset) V(std::forward<Args>(args)...);
+		Flags(first, segment)[offset].store(1);
+		Publish();
+		return index;
+	}
+
+	/*!
+	 * @brief Gets the number of elements readers can see
+	 * @return The number of fully constructed elements
+	 */
+	size_type size() const noexcept(true) {
+
+		return _size.load(std::memory_order_acquire);
+	}
+
+	/*!
+	 * @brief Checks if no element can be seen yet
+	 * @return True if size() is 0
+	 */
+	bool empty() const noexcept(true) {
+
+		return size() == 0;
+	}
+
+	/*!
+	 * @brief Gets an element
+	 * @param index The index of the element, less than size()
+	 * @return A reference to the element
+	 */
+	V &operator[](size_type index) noexcept(true) {
+
+		std::size_t offset;
+		const std::size_t segment = SegmentOf(index, offset);
+		return Segment(segment)[offset];
+	}
+
+	/*!
+	 * @brief Gets an element
+	 * @param index The index of the element, less than size()
+	 * @return A reference to the element
+	 */
+	const V &operator[](size_type index) const noexcept(true) {
+
+		std::size_t offset;
+		const std::size_t segment = SegmentOf(index, offset);
+		return Segment(segment)[offset];
+	}
+
+	/*!
+	 * @brief Gets the first element
+	 * @return An iterator to the first element
+	 */
+	iterator begin() noexcept(true) {
+
+		return iterator(*this, 0);
+	}
+
+	/*!
+	 * @brief Gets the end of the elements that can be seen now, which later
+	 * appends do not move
+	 * @return An iterator past the last element
+	 */
+	iterator end() noexcept(true) {
+
+		return iterator(*this, size());
+	}
+
+	/*!
+	 * @brief Gets the first element
+	 * @return An iterator to the first element
+	 */
+	const_iterator begin() const noexcept(true) {
+
+		return const_iterator(*this, 0);
+	}
+
+	/*!
+	 * @brief Gets the end of the elements that can be seen now, which later
+	 * appends do not move
+	 * @return An iterator past the last element
+	 */
+	const_iterator end() const noexcept(true) {
+
+		return const_iterator(*this, size());
+	}
+};
+
+/*!
+ * @brief IteratorWrapper for a ConcurrentVector
+ * @details
+ *      Batch and Segments hand over a segment at a time instead of stepping
+ *      the iterator for every element
+ * @tparam T The base class type
+ * @tparam U The ConcurrentIterator type
+ */
+template<typename T, typename U>
+class IteratorWrapperConcurrent : public IteratorWrapper<T, U>
+{
+	typedef typename make_const<U>::type CU;
+	typedef typename make_mutable<U>::type MU;
+
+public:
+
+	/*!
+	 * @brief Conversion constructor, takes an iterator
+	 * @param iterator The iterator to store internally
+	 */
+	explicit IteratorWrapperConcurrent(CU &iterator) noexcept(true) : IteratorWrapper<T, U>(iterator) {
+	}
+
+	/*!
+	 * @brief Default destructor
+	 */
+	virtual ~IteratorWrapperConcurrent() noexcept(true) = default;
+
+	/*!
+	 * @brief Batched increment, writes the addresses of up to count elements
+	 * into out and moves this iterator past them
+	 * @param out The array to write the element addresses into
+	 * @param count The size of the out array
+	 * @param end The iterator to stop at
+	 * @return The number of addresses written
+	 */
+	virtual std::size_t Batch(T **out, std::size_t count, const Iterator<T> &end) noexcept(true) {
+
+		MU       &it   = IteratorWrapper<T, U>::_it;
+		const MU &last = reinterpret_cast<const IteratorWrapperConcurrent<T, U> &>(end)._it;
+		std::size_t written = 0;
+		while (written < count && it != last) {
+			std::size_t run = it.Run(last);
+			if (run > count - written) {
+				run = count - written;
+			}
+			auto *first = &*it;
+			for (std::size_t i = 0; i < run; ++i) {
+				out[written + i] = first + i;
+			}
+			written += run;
+			it += static_cast<long>(run);
+		}
+		return written;
+	}
+
+	/*!
+	 * @brief Segmented increment, writes one run per segment into out and
+	 * moves this iterator past them
+	 * @param out The array to write the runs into
+	 * @param count The size of the out array
+	 * @param end The iterator to stop at
+	 * @return The number of runs written
+	 */
+	virtual std::size_t Segments(Span<T> *out, std::size_t count, const Iterator<T> &end) noexcept(true) {
+
+		MU       &it   = IteratorWrapper<T, U>::_it;
+		const MU &last = reinterpret_cast<const IteratorWrapperConcurrent<T, U> &>(end)._it;
+		const std::type_info *type = this->ExactType();
+		std::size_t written = 0;
+		for (; written < count && it != last; ++written) {
+			const std::size_t run = it.Run(last);
+			out[written] = Span<T>{&*it, run, sizeof(*it), type};
+			it += static_cast<long>(run);
+		}
+		return written;
+	}
+
+	/*!
+	 * @brief Copies this iterator
+	 * @return A new, identical iterator
+	 */
+	virtual Iterator<T> *Copy() const noexcept(true) {
+
+		return new IteratorWrapperConcurrent(IteratorWrapper<T, U>::_it);
+	}
+};
+
+/*!
+ * @brief Creates an iterator over a ConcurrentVector
+ * @tparam T The base type (must be specified)
+ * @tparam E The element type (can be deduced)
+ * @param iterator The iterator to store internally
+ * @return A new iterator
+ */
+template<typename T, typename E>
+Iterator<T> MakeIterator(const ConcurrentIterator<E> &iterator) {
+
+	return static_cast<Iterator<T>>(*new IteratorWrapperConcurrent<T, ConcurrentIterator<E>>(iterator));
+}
+
+#endif //TEMPL_ITERATOR_CONCURRENT_VECTOR_H
@@ -0,0 +1,104 @@
+/*!
+ * @file cursor_driver.cpp
+ * @author Saadiq Daniels
+ * @date 18/10/2026
+ * @version 1.0
+ */
+
+#include <chrono>
+#include <iostream>
+#include <list>
+#include <memory>
+#include <vector>
+
+#include "iterator.h"
+#include "iterator_cursor.h"
+#include "base.h"
+
+/*!
+ * Tests walking containers a time budget at a time across simulated frames
+ * @return 0
+ */
+int main() {
+
+	// Creating data //
+
+	std::vector<derived1> derived1_vector;
+	std::list<derived2> derived2_list;
+	for (int i = 0; i < 200000; ++i) {
+		derived1_vector.emplace_back(static_cast<float>(i % 100));
+		derived2_list.emplace_back(static_cast<float>(i % 100));
+	}
+
+	// Frame sliced update of the vector, which reallocates between frames //
+	const std::chrono::microseconds budget(100);
+	Cursor<base> vector_cursor;
+	std::size_t visited = 0;
+	int frames = 0;
+	bool finished = false;
+	while (!finished) {
+		++frames;
+		const std::size_t before = vector_cursor.Position();
+		finished = vector_cursor.RunFor(MakeRange<base>(derived1_vector), budget, [&visited](base &) {
+			++visited;
+		});
+		if (frames <= 5) {
+			std::cout << "Frame " << frames << ": " << before << " -> "
+			          << (finished ? derived1_vector.size() : vector_cursor.Position()) << std::endl;
+		}
+		// Growing the vector moves every element, the cursor only holds an index
+		derived1_vector.emplace_back(1.f);
+		derived1_vector.shrink_to_fit();
+	}
+	std::cout << "Derived1_Vector: visited " << visited << " of " << derived1_vector.size()
+	          << " elements in " << frames << " frames" << std::endl;
+
+	// The same for a list, checking the clock every 16 elements //
+	Cursor<base> list_cursor(16);
+	std::size_t list_visited = 0;
+	frames = 0;
+	while (!list_cursor.RunFor(MakeRange<base>(derived2_list), budget, [&list_visited](base &) {
+		++list_visited;
+	})) {
+		++frames;
+	}
+	std::cout << "Derived2_List: visited " << list_visited << " of " << derived2_list.size()
+	          << " elements in " << frames + 1 << " frames" << std::endl;
+
+	// A range that skips null entries, resumed after every 16 elements //
+	std::vector<std::unique_ptr<derived1>> scattered(1000);
+	for (std::size_t i = 0; i < scattered.size(); i += 2) {
+		scattered[i] = std::make_unique<derived1>(1.f);
+	}
+	Cursor<base> indirect_cursor(16);
+	std::size_t indirect_visited = 0;
+	while (!indirect_cursor.RunFor(MakeRangeIndirect<base>(scattered), std::chrono::microseconds(0),
+	                               [&indirect_visited](base &) {
+		++indirect_visited;
+	})) {
+	}
+	std::cout << "Indirect_Vector: visited " << indirect_visited << " of 500 live elements" << std::endl;
+
+	// Leading null entries filled in between calls must not move the cursor //
+	std::vector<std::unique_ptr<derived1>> filling(1000);
+	for (std::size_t i = 100; i < filling.size(); ++i) {
+		filling[i] = std::make_unique<derived1>(1.f);
+	}
+	Cursor<base> filling_cursor(16);
+	std::size_t filling_visited = 0;
+	const auto count_filling = [&filling_visited](base &) {
+		++filling_visited;
+	};
+	filling_cursor.RunFor(MakeRangeIndirect<base>(filling), std::chrono::microseconds(0), count_filling);
+	for (std::size_t i = 0; i < 100; ++i) {
+		filling[i] = std::make_unique<derived1>(1.f);
+	}
+	while (!filling_cursor.RunFor(MakeRangeIndirect<base>(filling), std::chrono::microseconds(0), count_filling)) {
+	}
+	std::cout << "Filled_Vector: resumed at entry 116 and visited " << filling_visited << " of 900" << std::endl;
+
+	// Large check intervals are capped at the batch size //
+	const bool capped = Cursor<base>(ITERATOR_BATCH_SIZE * 2).CheckEvery() == ITERATOR_BATCH_SIZE;
+
+	return list_visited == derived2_list.size() && indirect_visited == 500 && filling_visited == 900 && capped ? 0 : 1;
+}
@@ -0,0 +1,111 @@
+/*!
+ * @file deque_driver.cpp
+ * @author Saadiq Daniels
+ * @date 18/10/2026
+ * @version 1.0
+ */
+
+#include <deque>
+#include <iostream>
+
+#include "iterator.h"
+#include "base.h"
+#include "benchmark.h"
+
+/*!
+ * Tests walking a std::deque one contiguous block at a time
+ * @return 0
+ */
+int main() {
+
+	// Creating data //
+
+	const int count = 1 << 20;
+	std::deque<derived4> derived4_deque;
+	for (int i = 0; i < count; ++i) {
+		// Alternate between pushing to the front and back
+		if (i % 2) {
+			derived4_deque.emplace_front(static_cast<float>(i % 100));
+		} else {
+			derived4_deque.emplace_back(static_cast<float>(i % 100));
+		}
+	}
+
+	// Counting the blocks //
+	const Range<base> deque_range = MakeRange<base>(derived4_deque);
+	std::size_t blocks = 0;
+	std::size_t elements = 0;
+	ForEachSegment(deque_range, [&blocks, &elements](const Span<base> &segment) {
+		++blocks;
+		elements += segment.count;
+	});
+	std::cout << "Derived4_Deque: " << elements << " elements in " << blocks << " blocks" << std::endl;
+
+	// Starting and stopping part way through a block, every run should be a
+	// whole stretch of neighbouring elements, found without stepping through it
+	const std::size_t skip = 5;
+	const Range<base> inner_range(MakeIterator<base>(derived4_deque.begin() + skip),
+	                              MakeIterator<base>(derived4_deque.end() - skip));
+	const std::size_t block = deque_block_size<derived4>::value;
+	std::size_t index = skip;
+	std::size_t runs = 0;
+	bool addresses = true;
+	ForEachSegment(inner_range, [&](const Span<base> &segment) {
+		++runs;
+		addresses = addresses && segment.count <= block;
+		for (std::size_t i = 0; i < segment.count; ++i, ++index) {
+			addresses = addresses && &segment[i] == &derived4_deque[index];
+		}
+	});
+	std::size_t breaks = 1;
+	for (std::size_t i = skip + 1; i < derived4_deque.size() - skip; ++i) {
+		breaks += &derived4_deque[i] != &derived4_deque[i - 1] + 1;
+	}
+	// Blocks next to each other in memory are still separate runs
+	const std::size_t most = breaks + (derived4_deque.size() - 2 * skip) / block + 1;
+	if (!addresses || index != derived4_deque.size() - skip || runs < breaks || runs > most) {
+		std::cout << "Blocks do not match the deque" << std::endl;
+		return 1;
+	}
+
+	// Benchmarking //
+
+	double sums[3] = {};
+
+	double time = Benchmark(5, [&]() {
+		double sum = 0.0;
+		for (Iterator<base> it = deque_range.begin(), end = deque_range.end(); it != end; ++it) {
+			sum += it->getfloat();
+		}
+		sums[0] = sum;
+	});
+	Report("deque Iterator<base> loop", time, count, count * sizeof(derived4));
+
+	time = Benchmark(5, [&]() {
+		double sum = 0.0;
+		ForEach(deque_range, [&sum](const base &rhs) {
+			sum += rhs.getfloat();
+		});
+		sums[1] = sum;
+	});
+	Report("deque ForEach", time, count, count * sizeof(derived4));
+
+	time = Benchmark(5, [&]() {
+		double sum = 0.0;
+		ForEachSegment(deque_range, [&sum](const Span<base> &segment) {
+			for (std::size_t i = 0; i < segment.count; ++i) {
+				sum += segment[i].getfloat();
+			}
+		});
+		sums[2] = sum;
+	});
+	Report("deque ForEachSegment", time, count, count * sizeof(derived4));
+
+	KeepAlive(sums[0] + sums[1] + sums[2]);
+	if (elements != derived4_deque.size() || sums[0] != sums[1] || sums[1] != sums[2]) {
+		std::cout << "Sums do not match" << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,124 @@
+/*!
+ * @file dirty_driver.cpp
+ * @author Saadiq Daniels
+ * @date 18/10/2026
+ * @version 1.0
+ */
+
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "iterator.h"
+#include "dirty_set.h"
+#include "base.h"
+#include "benchmark.h"
+
+/*!
+ * Tests walking only the elements of a vector that were marked as changed
+ * @return 0, or 1 if the walks do not agree
+ */
+int main() {
+
+	// Creating data //
+
+	const std::size_t count = 1 << 20;
+	const std::size_t changed = count / 100;
+	std::vector<derived4> derived4_vector;
+	derived4_vector.reserve(count);
+	for (std::size_t i = 0; i < count; ++i) {
+		derived4_vector.emplace_back(static_cast<float>(i % 100));
+	}
+
+	// One percent of the elements change each frame
+	std::mt19937 random(7);
+	std::uniform_int_distribution<std::size_t> pick(0, count - 1);
+	std::vector<std::size_t> writes(changed);
+	for (std::size_t &write : writes) {
+		write = pick(random);
+	}
+
+	DirtySet<std::vector<derived4>> dirty(derived4_vector);
+	for (std::size_t write : writes) {
+		dirty.Mark(write);
+	}
+	const Range<base> all_range = MakeRange<base>(derived4_vector);
+	const Range<base> dirty_range = MakeRange<base>(dirty);
+
+	// Checking the marked elements //
+
+	std::size_t visited = 0;
+	std::size_t previous = 0;
+	bool ordered = true;
+	for (auto it = dirty.begin(); it != dirty.end(); ++it) {
+		ordered = ordered && (visited == 0 || it.Index() > previous) && dirty.Dirty(it.Index());
+		previous = it.Index();
+		++visited;
+	}
+	const std::size_t marked = dirty.Count();
+	std::cout << "Derived4_Vector: " << visited << " of " << count << " elements marked" << std::endl;
+
+	// Benchmarking //
+
+	double sums[3] = {};
+
+	double time = Benchmark(5, [&]() {
+		double sum = 0.0;
+		ForEach(all_range, [&sum](base &rhs) {
+			sum += rhs.getfloat();
+		});
+		sums[0] = sum;
+	});
+	Report("vector ForEach every element", time, count, count * sizeof(derived4));
+
+	time = Benchmark(5, [&]() {
+		double sum = 0.0;
+		for (std::size_t i = 0; i < count; ++i) {
+			if (dirty.Dirty(i)) {
+				sum += derived4_vector[i].getfloat();
+			}
+		}
+		sums[1] = sum;
+	});
+	Report("vector check every element", time, count, count * sizeof(derived4));
+
+	time = Benchmark(5, [&]() {
+		double sum = 0.0;
+		ForEach(dirty_range, [&sum](base &rhs) {
+			sum += rhs.getfloat();
+		});
+		sums[2] = sum;
+	});
+	Report("DirtySet ForEach marked elements", time, visited, visited * sizeof(derived4));
+
+	time = Benchmark(5, [&]() {
+		for (std::size_t write : writes) {
+			dirty.Mark(write);
+		}
+		dirty.Clear();
+	});
+	Report("DirtySet Mark and Clear", time, changed, changed * sizeof(std::size_t));
+
+	// Marks past the end are left out of Count the same way iteration drops
+	// them, and a mark near the end does not start the walk at word 0
+	std::vector<derived4> small_vector(100, derived4(1.f));
+	DirtySet<std::vector<derived4>> small_dirty(small_vector);
+	small_dirty.Mark(98);
+	small_dirty.Mark(99);
+	small_dirty.Mark(150);
+	small_vector.pop_back();
+	std::size_t small_visited = 0;
+	for (auto it = small_dirty.begin(); it != small_dirty.end(); ++it) {
+		++small_visited;
+	}
+	const bool clipped = small_dirty.Count() == 1 && small_visited == 1 && small_dirty.begin().Index() == 98;
+
+	KeepAlive(sums[0] + sums[1] + sums[2]);
+	if (!ordered || visited != marked || dirty.Count() != 0 || sums[1] != sums[2] || !clipped) {
+		std::cout << "Walks do not match" << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
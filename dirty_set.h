@@ -0,0 +1,338 @@
+/*!
+ * @file dirty_set.h
+ * @author Saadiq Daniels
+ * @date 18/10/2026
+ * @version 1.0
+ * @brief
+ * 	A change tracker for vector or deque backed containers, which keeps a
+ * 	bit for every element and iterates over only the marked ones
+ */
+
+#ifndef TEMPL_ITERATOR_DIRTY_SET_H
+#define TEMPL_ITERATOR_DIRTY_SET_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "iterator.h"
+
+/*!
+ * @brief Finds the lowest set bit of a word
+ * @param word The word to look at, which must not be 0
+ * @return The index of the lowest set bit
+ */
+inline unsigned LowestBit(std::uint64_t word) noexcept(true) {
+
+#if defined(__GNUC__)
+	return static_cast<unsigned>(__builtin_ctzll(word));
+#else
+	unsigned bit = 0;
+	while (!(word & 1)) {
+		word >>= 1;
+		++bit;
+	}
+	return bit;
+#endif
+}
+
+/*!
+ * @brief Counts the set bits of a word
+ * @param word The word to look at
+ * @return The number of set bits
+ */
+inline unsigned BitCount(std::uint64_t word) noexcept(true) {
+
+#if defined(__GNUC__)
+	return static_cast<unsigned>(__builtin_popcountll(word));
+#else
+	unsigned count = 0;
+	for (; word; word &= word - 1) {
+		++count;
+	}
+	return count;
+#endif
+}
+
+template<typename C>
+class DirtySet;
+
+/*!
+ * @brief Walks the marked elements of a DirtySet in index order
+ * @tparam C The container type
+ */
+template<typename C>
+class DirtyIterator
+{
+public:
+	// User friendly names for data types
+	using iterator_category = std::forward_iterator_tag;
+	using value_type = typename C::value_type;
+	using difference_type = long;
+	using pointer = std::conditional_t<std::is_const<C>::value, const value_type *, value_type *>;
+	using reference = std::conditional_t<std::is_const<C>::value, const value_type &, value_type &>;
+
+private:
+	// The set being iterated over
+	const DirtySet<C> *_set;
+	// The word holding the current element's bit
+	std::size_t       _word;
+	// The bits of that word not visited yet, including the current element
+	std::uint64_t     _bits;
+
+	/*!
+	 * @brief Moves to the next word with a bit set when the current one runs out,
+	 * skipping clean words 64 elements at a time
+	 */
+	void Settle() noexcept(true) {
+
+		const std::vector<std::uint64_t> &words = _set->_bits;
+		while (!_bits) {
+			if (++_word >= words.size()) {
+				_word = words.size();
+				return;
+			}
+			_bits = words[_word];
+		}
+		// Marks past the end of the container are dropped
+		if (Index() >= _set->_container->size()) {
+			_word = words.size();
+			_bits = 0;
+		}
+	}
+
+public:
+
+	/*!
+	 * @brief Conversion constructor
+	 * @param set The set to iterate over
+	 * @param word The first word to look at, the number of words for the end
+	 */
+	DirtyIterator(const DirtySet<C> &set, std::size_t word) noexcept(true)
+			: _set(&set), _word(word), _bits(word < set._bits.size() ? set._bits[word] : 0) {
+
+		if (_word < _set->_bits.size()) {
+			// Find the first marked element at or after word
+			if (!_bits) {
+				Settle();
+			} else if (Index() >= _set->_container->size()) {
+				_word = _set->_bits.size();
+				_bits = 0;
+			}
+		}
+	}
+
+	/*!
+	 * @brief Gets the index of the current element in the container
+	 * @return The index
+	 */
+	std::size_t Index() const noexcept(true) {
+
+		return _word * 64 + LowestBit(_bits);
+	}
+
+	/*!
+	 * @brief Dereference operator
+	 * @return A reference to the current element
+	 */
+	reference operator*() const noexcept(true) {
+
+		return (*_set->_container)[Index()];
+	}
+
+	/*!
+	 * @brief Arrow operator
+	 * @return A pointer to the current element
+	 */
+	pointer operator->() const noexcept(true) {
+
+		return &**this;
+	}
+
+	/*!
+	 * @brief Increment operator, moves to the next marked element
+	 * @return A reference to this iterator
+	 */
+	DirtyIterator &operator++() noexcept(true) {
+
+		// Clear the lowest bit
+		_bits &= _bits - 1;
+		Settle();
+		return *this;
+	}
+
+	/*!
+	 * @brief Equality operator
+	 * @param rhs The iterator to compare with
+	 * @return True if both iterators point at the same element
+	 */
+	bool operator==(const DirtyIterator &rhs) const noexcept(true) {
+
+		return _word == rhs._word && _bits == rhs._bits;
+	}
+
+	/*!
+	 * @brief Inequality operator
+	 * @param rhs The iterator to compare with
+	 * @return False if both iterators point at the same element
+	 */
+	bool operator!=(const DirtyIterator &rhs) const noexcept(true) {
+
+		return !(*this == rhs);
+	}
+};
+
+/*!
+ * @brief Keeps a dirty bit for every element of a random access container
+ * @details
+ *      Mark sets one bit and is cheap enough for hot write paths, Clear only
+ *      touches the words that were marked. begin and end walk the marked
+ *      elements in index order, so MakeRange<T>(dirty) gives an Iterator<T>
+ *      over just the elements that changed. The container can grow while
+ *      it is tracked; marks are by index, so erasing from the middle moves
+ *      them to other elements.
+ * @tparam C The container type, such as std::vector< derived > or std::deque< derived >
+ */
+template<typename C>
+class DirtySet
+{
+public:
+	// User friendly names for data types
+	using value_type = typename C::value_type;
+	using size_type = std::size_t;
+	using iterator = DirtyIterator<C>;
+
+	friend class DirtyIterator<C>;
+
+private:
+	// The container being tracked
+	C                          *_container;
+	// One bit for every element
+	std::vector<std::uint64_t> _bits;
+	// The words with at least one bit set, in the order they were first marked
+	std::vector<std::size_t>   _marked;
+	// The lowest word in _marked, or the largest size_type if nothing is marked
+	std::size_t                _lowest;
+
+public:
+
+	/*!
+	 * @brief Conversion constructor
+	 * @param container The container to track, nothing is marked to begin with
+	 */
+	explicit DirtySet(C &container)
+			: _container(&container), _bits((container.size() + 63) / 64),
+			  _lowest(std::numeric_limits<std::size_t>::max()) {
+	}
+
+	/*!
+	 * @brief Marks an element as changed
+	 * @param index The index of the element in the container
+	 */
+	void Mark(size_type index) {
+
+		const size_type word = index / 64;
+		if (word >= _bits.size()) {
+			_bits.resize(word + 1);
+		}
+		if (!_bits[word]) {
+			_marked.push_back(word);
+			if (word < _lowest) {
+				_lowest = word;
+			}
+		}
+		_bits[word] |= std::uint64_t(1) << (index % 64);
+	}
+
+	/*!
+	 * @brief Marks every element as changed
+	 */
+	void MarkAll() {
+
+		Clear();
+		const size_type size = _container->size();
+		_bits.assign((size + 63) / 64, ~std::uint64_t(0));
+		if (size % 64) {
+			_bits.back() = (std::uint64_t(1) << (size % 64)) - 1;
+		}
+		for (size_type word = 0; word < _bits.size(); ++word) {
+			_marked.push_back(word);
+		}
+		if (!_marked.empty()) {
+			_lowest = 0;
+		}
+	}
+
+	/*!
+	 * @brief Checks if an element is marked
+	 * @param index The index of the element in the container
+	 * @return True if the element is marked
+	 */
+	bool Dirty(size_type index) const noexcept(true) {
+
+		const size_type word = index / 64;
+		return word < _bits.size() && (_bits[word] >> (index % 64)) & 1;
+	}
+
+	/*!
+	 * @brief Unmarks every element, only touching the words that were marked
+	 */
+	void Clear() noexcept(true) {
+
+		for (size_type word : _marked) {
+			_bits[word] = 0;
+		}
+		_marked.clear();
+		_lowest = std::numeric_limits<std::size_t>::max();
+	}
+
+	/*!
+	 * @brief Counts the marked elements
+	 * @details
+	 *      Marks past the end of the container are left out, the same as
+	 *      iteration drops them, so Count matches the length of the range
+	 * @return The number of marked elements
+	 */
+	size_type Count() const noexcept(true) {
+
+		const size_type size = _container->size();
+		size_type count = 0;
+		for (size_type word : _marked) {
+			if (word * 64 >= size) {
+				continue;
+			}
+			std::uint64_t bits = _bits[word];
+			if (size - word * 64 < 64) {
+				bits &= (std::uint64_t(1) << (size - word * 64)) - 1;
+			}
+			count += BitCount(bits);
+		}
+		return count;
+	}
+
+	/*!
+	 * @brief Gets an iterator to the first marked element
+	 * @details
+	 *      Starts at the lowest marked word, so a few marks near the end of a
+	 *      large container do not cost a scan over all the clean words before them
+	 * @return An iterator to the first marked element
+	 */
+	iterator begin() const noexcept(true) {
+
+		return iterator(*this, _lowest < _bits.size() ? _lowest : _bits.size());
+	}
+
+	/*!
+	 * @brief Gets an iterator past the last marked element
+	 * @return An iterator past the last marked element
+	 */
+	iterator end() const noexcept(true) {
+
+		return iterator(*this, _bits.size());
+	}
+};
+
+#endif //TEMPL_ITERATOR_DIRTY_SET_H
@@ -0,0 +1,246 @@
+/*!
+ * @file engine_benchmark.cpp
+ * @author Saadiq Daniels
+ * @date 18/10/2026
+ * @version 1.0
+ * @brief
+ * 	Updates every component of an engine made of many containers of
+ * 	different kinds, at growing sizes and thread counts, and prints the
+ * 	throughput of each way of walking them as CSV or JSON
+ *
+ * 	Usage: engine_benchmark [--json] [--max components] [--threads count]
+ */
+
+#include <cstdlib>
+#include <deque>
+#include <functional>
+#include <iostream>
+#include <list>
+#include <map>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "iterator.h"
+#include "iterator_parallel.h"
+#include "base.h"
+#include "benchmark.h"
+
+/*!
+ * The containers of an engine, one of each kind for every group, stored
+ * behind ranges so the update loop does not know what they are
+ */
+struct Engine
+{
+	std::vector<std::vector<derived4>>              vectors;
+	std::vector<std::list<derived4>>                lists;
+	std::vector<std::deque<derived4>>               deques;
+	std::vector<std::map<derived4, int>>            maps;
+	std::vector<std::unordered_map<int, derived4>>  hashes;
+	// Every container, as the engine's update loop sees them
+	std::vector<Range<const base>>                  ranges;
+
+	/*!
+	 * Fills the engine with components
+	 * @param components The total number of components
+	 * @param groups The number of containers of each kind
+	 */
+	Engine(std::size_t components, std::size_t groups)
+			: vectors(groups), lists(groups), deques(groups), maps(groups), hashes(groups) {
+
+		const std::size_t each = components / (groups * 5);
+		for (std::size_t g = 0; g < groups; ++g) {
+			vectors[g].reserve(each);
+			hashes[g].reserve(each);
+			for (std::size_t i = 0; i < each; ++i) {
+				const auto number = static_cast<float>(i % 100);
+				vectors[g].emplace_back(number);
+				lists[g].emplace_back(number);
+				deques[g].emplace_back(number);
+				maps[g].emplace(derived4(number), static_cast<int>(i));
+				derived4 hashed(number);
+				hashes[g].emplace(hashed.getInt(), hashed);
+			}
+			ranges.push_back(MakeRange<const base>(vectors[g]));
+			ranges.push_back(MakeRange<const base>(lists[g]));
+			ranges.push_back(MakeRange<const base>(deques[g]));
+			ranges.push_back(MakeRangeLeft<const base>(maps[g]));
+			ranges.push_back(MakeRangeRight<const base>(hashes[g]));
+		}
+	}
+
+	/*!
+	 * Gets the number of components
+	 * @return The number of components in all of the containers
+	 */
+	std::size_t Size() const {
+
+		return vectors.size() * vectors.front().size() * 5;
+	}
+};
+
+/*!
+ * Prints results as CSV or as a JSON array
+ */
+class Output
+{
+	// True for JSON, false for CSV
+	bool _json;
+	// True until the first row has been printed
+	bool _first;
+
+public:
+	/*!
+	 * Prints the CSV header or opens the JSON array
+	 * @param json True for JSON, false for CSV
+	 */
+	explicit Output(bool json) : _json(json), _first(true) {
+
+		std::cout << (_json ? "[" : "components,containers,path,threads,seconds,components_per_second") << std::endl;
+	}
+
+	/*!
+	 * Closes the JSON array
+	 */
+	~Output() {
+
+		if (_json) {
+			std::cout << std::endl << "]" << std::endl;
+		}
+	}
+
+	/*!
+	 * Prints one measurement
+	 * @param engine The engine that was updated
+	 * @param path The way the components were walked
+	 * @param threads The number of threads used
+	 * @param seconds The time one full update took
+	 */
+	void Row(const Engine &engine, const std::string &path, std::size_t threads, double seconds) {
+
+		const double rate = static_cast<double>(engine.Size()) / seconds;
+		if (_json) {
+			std::cout << (_first ? "" : ",\n") << "  {\"components\": " << engine.Size()
+			          << ", \"containers\": " << engine.ranges.size() << ", \"path\": \"" << path
+			          << "\", \"threads\": " << threads << ", \"seconds\": " << seconds
+			          << ", \"components_per_second\": " << rate << "}";
+		} else {
+			std::cout << engine.Size() << "," << engine.ranges.size() << "," << path << "," << threads << ","
+			          << seconds << "," << rate << std::endl;
+		}
+		_first = false;
+	}
+};
+
+/*!
+ * Runs the benchmarks
+ * @param argc The number of arguments
+ * @param argv --json, --max components, --threads count
+ * @return 0, or 1 if the paths do not agree
+ */
+int main(int argc, char **argv) {
+
+	bool json = false;
+	std::size_t max = 1000000;
+	std::size_t maxThreads = std::thread::hardware_concurrency();
+	for (int i = 1; i < argc; ++i) {
+		const std::string argument = argv[i];
+		if (argument == "--json") {
+			json = true;
+		} else if (argument == "--max" && i + 1 < argc) {
+			max = std::strtoul(argv[++i], nullptr, 10);
+		} else if (argument == "--threads" && i + 1 < argc) {
+			maxThreads = std::strtoul(argv[++i], nullptr, 10);
+		}
+	}
+	if (maxThreads == 0) {
+		maxThreads = 1;
+	}
+
+	Output output(json);
+	const std::size_t groups = 4;
+	const int runs = 3;
+	for (std::size_t components = 1000; components <= max; components *= 10) {
+		Engine engine(components, groups);
+		double sums[4] = {};
+
+		// The plain loop every caller can write
+		double time = Benchmark(runs, [&]() {
+			double sum = 0.0;
+			for (const Range<const base> &range : engine.ranges) {
+				for (Iterator<const base> it = range.begin(), end = range.end(); it != end; ++it) {
+					sum += it->getfloat();
+				}
+			}
+			sums[0] = sum;
+		});
+		output.Row(engine, "iterator", 1, time);
+
+		time = Benchmark(runs, [&]() {
+			double sum = 0.0;
+			for (const Range<const base> &range : engine.ranges) {
+				ForEach(range, [&sum](const base &rhs) {
+					sum += rhs.getfloat();
+				});
+			}
+			sums[1] = sum;
+		});
+		output.Row(engine, "foreach", 1, time);
+
+		time = Benchmark(runs, [&]() {
+			double sum = 0.0;
+			for (const Range<const base> &range : engine.ranges) {
+				ForEachSegment(range, [&sum](const Span<const base> &segment) {
+					for (std::size_t i = 0; i < segment.count; ++i) {
+						sum += segment[i].getfloat();
+					}
+				});
+			}
+			sums[2] = sum;
+		});
+		output.Row(engine, "segments", 1, time);
+
+		// Every container is split into pieces which the threads share, each
+		// piece adds its total once. Split gives every piece its own
+		// iterators, so the tasks can copy them without locking.
+		for (std::size_t threads = 1; threads <= maxThreads; ++threads) {
+			ThreadPool pool(threads);
+			time = Benchmark(runs, [&]() {
+				std::vector<Range<const base>> pieces;
+				for (const Range<const base> &range : engine.ranges) {
+					for (Range<const base> &piece : range.Split(threads * ITERATOR_PIECES_PER_THREAD)) {
+						pieces.push_back(std::move(piece));
+					}
+				}
+				std::vector<double> totals(pieces.size());
+				std::vector<std::function<void()>> tasks;
+				tasks.reserve(pieces.size());
+				for (std::size_t i = 0; i < pieces.size(); ++i) {
+					tasks.emplace_back([&pieces, &totals, i]() {
+						double sum = 0.0;
+						ForEach(pieces[i], [&sum](const base &rhs) {
+							sum += rhs.getfloat();
+						});
+						totals[i] = sum;
+					});
+				}
+				pool.Run(std::move(tasks));
+				double sum = 0.0;
+				for (double total : totals) {
+					sum += total;
+				}
+				sums[3] = sum;
+			});
+			output.Row(engine, "parallel", threads, time);
+		}
+
+		KeepAlive(sums[0]);
+		if (sums[0] != sums[1] || sums[1] != sums[2] || sums[2] != sums[3]) {
+			std::cerr << "Sums do not match" << std::endl;
+			return 1;
+		}
+	}
+
+	return 0;
+}
@@ -0,0 +1,64 @@
+/*!
+ * @file function_ref.h
+ * @author Saadiq Daniels
+ * @date 18/10/2026
+ * @version 1.0
+ * @brief
+ * 	A non-owning reference to any callable, so a lambda can be passed
+ * 	through a virtual function without a heap allocation
+ */
+
+#ifndef TEMPL_ITERATOR_FUNCTION_REF_H
+#define TEMPL_ITERATOR_FUNCTION_REF_H
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+template<typename Signature>
+class FunctionRef;
+
+/*!
+ * @brief A non-owning reference to a callable
+ * @details
+ *      Unlike std::function nothing is copied or allocated, so the callable
+ *      must outlive the FunctionRef. It is meant to be passed as a function
+ *      parameter and never stored.
+ * @tparam R The return type
+ * @tparam Args The parameter types
+ */
+template<typename R, typename... Args>
+class FunctionRef<R(Args...)>
+{
+	// The callable being referenced
+	void *_callable;
+	// Calls the callable with its real type
+	R (*_call)(void *, Args...);
+
+public:
+
+	/*!
+	 * @brief Conversion constructor, takes any callable
+	 * @tparam F The callable type (can be deduced)
+	 * @param callable The callable to reference
+	 */
+	template<typename F, typename = std::enable_if_t<!std::is_same<std::decay_t<F>, FunctionRef>::value>>
+	FunctionRef(F &&callable) noexcept(true)
+			: _callable(const_cast<void *>(static_cast<const void *>(std::addressof(callable)))),
+			  _call([](void *object, Args... args) -> R {
+				  return (*static_cast<std::remove_reference_t<F> *>(object))(std::forward<Args>(args)...);
+			  }) {
+	}
+
+	/*!
+	 * @brief Calls the referenced callable
+	 * @param args The arguments to pass on
+	 * @return Whatever the callable returns
+	 */
+	R operator()(Args... args) const {
+
+		return _call(_callable, std::forward<Args>(args)...);
+	}
+};
+
+#endif //TEMPL_ITERATOR_FUNCTION_REF_H
@@ -0,0 +1,384 @@
+/*!
+ * @file generator.h
+ * @author Saadiq Daniels
+ * @date 18/10/2026
+ * @version 1.0
+ * @brief
+ * 	A C++20 coroutine generator that can be built from any Iterator<T>
+ * 	range, so several containers can be pulled from one element (or one
+ * 	batch) at a time on the consumer's own schedule
+ */
+
+#ifndef TEMPL_ITERATOR_GENERATOR_H
+#define TEMPL_ITERATOR_GENERATOR_H
+
+#if !defined(__cpp_impl_coroutine)
+#error "generator.h needs a compiler with C++20 coroutines"
+#endif
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "iterator.h"
+
+// The size classes of the frame pool are multiples of this many bytes
+#ifndef GENERATOR_FRAME_ALIGN
+#define GENERATOR_FRAME_ALIGN 64
+#endif
+// Frames bigger than this are not pooled
+#ifndef GENERATOR_FRAME_MAX
+#define GENERATOR_FRAME_MAX 4096
+#endif
+
+/*!
+ * @brief Recycles coroutine frames so that making a generator does not go
+ * to the global allocator every time
+ * @details
+ *      Each thread keeps its own free list for every size class, so there
+ *      is no locking. A frame freed on another thread joins that thread's
+ *      lists. Blocks are released when the thread exits.
+ */
+class FramePool
+{
+	// A free block, linked through its own storage
+	struct Node
+	{
+		Node *next;
+	};
+
+	static constexpr std::size_t classes = GENERATOR_FRAME_MAX / GENERATOR_FRAME_ALIGN;
+
+	// The free lists for one thread
+	struct Lists
+	{
+		Node *free[classes] = {};
+
+		~Lists() {
+
+			for (Node *&head : free) {
+				while (head) {
+					Node *next = head->next;
+					::operator delete(head);
+					head = next;
+				}
+			}
+		}
+	};
+
+	/*!
+	 * @brief Gets the free lists of the calling thread
+	 */
+	static Lists &Local() noexcept(true) {
+
+		static thread_local Lists lists;
+		return lists;
+	}
+
+	/*!
+	 * @brief Finds the size class of an allocation
+	 */
+	static std::size_t Class(std::size_t size) noexcept(true) {
+
+		return (size + GENERATOR_FRAME_ALIGN - 1) / GENERATOR_FRAME_ALIGN - 1;
+	}
+
+public:
+
+	/*!
+	 * @brief Gets a block from the pool, or from the global allocator if the pool is empty
+	 * @param size The number of bytes needed
+	 * @return The block
+	 */
+	static void *Allocate(std::size_t size) {
+
+		if (size > GENERATOR_FRAME_MAX) {
+			return ::operator new(size);
+		}
+		const std::size_t index = Class(size);
+		Node *&head = Local().free[index];
+		if (head) {
+			Node *block = head;
+			head = block->next;
+			return block;
+		}
+		return ::operator new((index + 1) * GENERATOR_FRAME_ALIGN);
+	}
+
+	/*!
+	 * @brief Gives a block back to the pool
+	 * @param block The block from Allocate
+	 * @param size The size that was passed to Allocate
+	 */
+	static void Deallocate(void *block, std::size_t size) noexcept(true) {
+
+		if (size > GENERATOR_FRAME_MAX) {
+			::operator delete(block);
+			return;
+		}
+		Node *&head = Local().free[Class(size)];
+		head = new(block) Node{head};
+	}
+};
+
+/*!
+ * @brief A coroutine that yields a sequence of values, one per resume
+ * @tparam R The type yielded, usually a reference such as T &
+ */
+template<typename R>
+class Generator
+{
+public:
+	// User friendly names for data types
+	using value_type = std::remove_cv_t<std::remove_reference_t<R>>;
+	using reference = std::conditional_t<std::is_reference<R>::value, R, const R &>;
+	using pointer = std::add_pointer_t<reference>;
+
+	/*!
+	 * @brief The promise type the compiler uses to build the coroutine
+	 */
+	struct promise_type
+	{
+		// The last value yielded, which lives in the suspended coroutine
+		pointer _current = nullptr;
+
+		Generator get_return_object() noexcept(true) {
+
+			return Generator(std::coroutine_handle<promise_type>::from_promise(*this));
+		}
+
+		std::suspend_always initial_suspend() const noexcept(true) {
+
+			return {};
+		}
+
+		std::suspend_always final_suspend() const noexcept(true) {
+
+			return {};
+		}
+
+		std::suspend_always yield_value(reference value) noexcept(true) {
+
+			_current = std::addressof(value);
+			return {};
+		}
+
+		void return_void() const noexcept(true) {
+		}
+
+		void unhandled_exception() const noexcept(true) {
+
+			std::terminate();
+		}
+
+		static void *operator new(std::size_t size) {
+
+			return FramePool::Allocate(size);
+		}
+
+		static void operator delete(void *frame, std::size_t size) noexcept(true) {
+
+			FramePool::Deallocate(frame, size);
+		}
+	};
+
+	using handle_type = std::coroutine_handle<promise_type>;
+
+	/*!
+	 * @brief The iterator used by a range based for loop
+	 */
+	class iterator
+	{
+		handle_type _handle;
+
+	public:
+		using iterator_category = std::input_iterator_tag;
+		using value_type = Generator::value_type;
+		using difference_type = std::ptrdiff_t;
+		using reference = Generator::reference;
+		using pointer = Generator::pointer;
+
+		explicit iterator(handle_type handle) noexcept(true) : _handle(handle) {
+		}
+
+		reference operator*() const noexcept(true) {
+
+			return *_handle.promise()._current;
+		}
+
+		pointer operator->() const noexcept(true) {
+
+			return _handle.promise()._current;
+		}
+
+		iterator &operator++() {
+
+			_handle.resume();
+			return *this;
+		}
+
+		void operator++(int) {
+
+			++*this;
+		}
+
+		bool operator==(std::default_sentinel_t) const noexcept(true) {
+
+			return _handle.done();
+		}
+	};
+
+private:
+	// The coroutine
+	handle_type _handle;
+
+	explicit Generator(handle_type handle) noexcept(true) : _handle(handle) {
+	}
+
+public:
+
+	/*!
+	 * @brief Move constructor
+	 * @param rhs The generator to take the coroutine from
+	 */
+	Generator(Generator &&rhs) noexcept(true) : _handle(std::exchange(rhs._handle, nullptr)) {
+	}
+
+	/*!
+	 * @brief Move assignment operator
+	 * @param rhs The generator to take the coroutine from
+	 * @return A reference to this generator
+	 */
+	Generator &operator=(Generator &&rhs) noexcept(true) {
+
+		std::swap(_handle, rhs._handle);
+		return *this;
+	}
+
+	Generator(const Generator &) = delete;
+
+	Generator &operator=(const Generator &) = delete;
+
+	/*!
+	 * @brief Destroys the coroutine and gives its frame back to the pool
+	 */
+	~Generator() {
+
+		if (_handle) {
+			_handle.destroy();
+		}
+	}
+
+	/*!
+	 * @brief Runs the coroutine up to its next yield
+	 * @return False once the coroutine has finished
+	 */
+	bool Next() {
+
+		_handle.resume();
+		return !_handle.done();
+	}
+
+	/*!
+	 * @brief Gets the value from the last call to Next
+	 * @return The last value yielded
+	 */
+	reference Value() const noexcept(true) {
+
+		return *_handle.promise()._current;
+	}
+
+	/*!
+	 * @brief Starts the coroutine
+	 * @return An iterator at the first value
+	 */
+	iterator begin() {
+
+		_handle.resume();
+		return iterator(_handle);
+	}
+
+	/*!
+	 * @brief Gets the end of the sequence
+	 * @return A sentinel that compares equal once the coroutine has finished
+	 */
+	std::default_sentinel_t end() const noexcept(true) {
+
+		return {};
+	}
+};
+
+/*!
+ * @brief A batch of element addresses yielded by GenerateBatches
+ * @tparam T The base type
+ */
+template<typename T>
+struct BatchView
+{
+	T *const   *data;
+	std::size_t size;
+
+	T *const *begin() const noexcept(true) {
+
+		return data;
+	}
+
+	T *const *end() const noexcept(true) {
+
+		return data + size;
+	}
+};
+
+/*!
+ * @brief Makes a generator that yields every element of a range
+ * @details
+ *      The range is walked with Iterator<T>::Batch, so the only cost per
+ *      element is resuming the coroutine
+ * @tparam T The base type (can be deduced)
+ * @param range The range to walk
+ * @return The generator
+ */
+template<typename T>
+Generator<T &> Generate(Range<T> range) {
+
+	Iterator<T> current(range.begin());
+	const Iterator<T> end(range.end());
+	typename Iterator<T>::pointer batch[ITERATOR_BATCH_SIZE];
+	std::size_t count;
+	while ((count = current.Batch(batch, ITERATOR_BATCH_SIZE, end)) != 0) {
+		for (std::size_t i = 0; i < count; ++i) {
+			co_yield *batch[i];
+		}
+	}
+}
+
+/*!
+ * @brief Makes a generator that yields the elements of a range a batch at a time
+ * @details
+ *      The addresses in a batch are good until the generator is resumed
+ * @tparam T The base type (can be deduced)
+ * @param range The range to walk
+ * @param size The largest number of elements per batch, up to ITERATOR_BATCH_SIZE
+ * @return The generator
+ */
+template<typename T>
+Generator<BatchView<T>> GenerateBatches(Range<T> range, std::size_t size = ITERATOR_BATCH_SIZE) {
+
+	Iterator<T> current(range.begin());
+	const Iterator<T> end(range.end());
+	typename Iterator<T>::pointer batch[ITERATOR_BATCH_SIZE];
+	if (size > ITERATOR_BATCH_SIZE) {
+		size = ITERATOR_BATCH_SIZE;
+	}
+	std::size_t count;
+	while ((count = current.Batch(batch, size, end)) != 0) {
+		co_yield BatchView<T>{batch, count};
+	}
+}
+
+#endif //TEMPL_ITERATOR_GENERATOR_H
@@ -0,0 +1,117 @@
+/*!
+ * @file generator_driver.cpp
+ * @author Saadiq Daniels
+ * @date 18/10/2026
+ * @version 1.0
+ */
+
+#include <deque>
+#include <iostream>
+#include <list>
+#include <vector>
+
+#include "iterator.h"
+#include "generator.h"
+#include "base.h"
+#include "benchmark.h"
+
+/*!
+ * Tests coroutine generators over Iterator<T> ranges and compares them
+ * against hand written loops
+ * @return 0
+ */
+int main() {
+
+	// Creating data //
+
+	std::list<derived1> derived1_list;
+	std::deque<derived3> derived3_deque;
+	for (int i = 0; i < 10; ++i) {
+		derived1_list.emplace_back(static_cast<float>(i));
+		derived3_deque.emplace_back(static_cast<float>(i * 10));
+	}
+
+	// Pulling from two containers in turn //
+	Generator<base &> list_generator = Generate(MakeRange<base>(derived1_list));
+	Generator<base &> deque_generator = Generate(MakeRange<base>(derived3_deque));
+
+	std::cout << "Interleaved:" << std::endl;
+	bool list_more = true;
+	bool deque_more = true;
+	while (list_more || deque_more) {
+		if (list_more && (list_more = list_generator.Next())) {
+			std::cout << "(" << list_generator.Value().getInt() << ", " << list_generator.Value().getfloat() << ")\t";
+		}
+		if (deque_more && (deque_more = deque_generator.Next())) {
+			std::cout << "(" << deque_generator.Value().getInt() << ", " << deque_generator.Value().getfloat() << ")\t";
+		}
+	}
+	std::cout << std::endl;
+
+	// Benchmarking //
+
+	const int count = 1 << 20;
+	std::vector<derived1> derived1_vector;
+	derived1_vector.reserve(count);
+	for (int i = 0; i < count; ++i) {
+		derived1_vector.emplace_back(static_cast<float>(i % 100));
+	}
+	Range<base> vector_range = MakeRange<base>(derived1_vector);
+	float sums[4] = {};
+
+	double time = Benchmark(10, [&]() {
+		float sum = 0.f;
+		Iterator<base> end = vector_range.end();
+		for (Iterator<base> it = vector_range.begin(); it != end; ++it) {
+			sum += it->getfloat();
+		}
+		sums[0] = sum;
+	});
+	Report("Iterator<base> loop", time, count, count * sizeof(derived1));
+
+	time = Benchmark(10, [&]() {
+		float sum = 0.f;
+		ForEach(vector_range, [&sum](const base &rhs) {
+			sum += rhs.getfloat();
+		});
+		sums[1] = sum;
+	});
+	Report("ForEach", time, count, count * sizeof(derived1));
+
+	time = Benchmark(10, [&]() {
+		float sum = 0.f;
+		for (base &element : Generate(vector_range)) {
+			sum += element.getfloat();
+		}
+		sums[2] = sum;
+	});
+	Report("Generator<base &>", time, count, count * sizeof(derived1));
+
+	time = Benchmark(10, [&]() {
+		float sum = 0.f;
+		for (BatchView<base> batch : GenerateBatches(vector_range)) {
+			for (base *element : batch) {
+				sum += element->getfloat();
+			}
+		}
+		sums[3] = sum;
+	});
+	Report("Generator<BatchView<base>>", time, count, count * sizeof(derived1));
+
+	// Making generators should reuse frames from the pool
+	time = Benchmark(10, [&]() {
+		for (int i = 0; i < 100000; ++i) {
+			Generator<base &> generator = Generate(vector_range);
+			KeepAlive(generator.Next());
+		}
+	});
+	Report("Make and start a Generator", time, 100000, 0);
+
+	KeepAlive(sums[0] + sums[1] + sums[2] + sums[3]);
+	if (sums[0] != sums[1] || sums[0] != sums[2] || sums[0] != sums[3]) {
+		std::cout << "Sums do not match" << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,119 @@
+/*!
+ * @file indirect_driver.cpp
+ * @author Saadiq Daniels
+ * @date 18/10/2026
+ * @version 1.0
+ */
+
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "iterator.h"
+#include "base.h"
+#include "benchmark.h"
+
+/*!
+ * Tests iterating over containers of raw and smart pointers
+ * @return 0
+ */
+int main() {
+
+	// Creating data //
+
+	std::vector<std::unique_ptr<derived1>> derived1_owners;
+	std::vector<derived2 *> derived2_pointers;
+	std::vector<derived2> derived2_vector;
+	derived2_vector.reserve(10);
+	for (int i = 0; i < 10; ++i) {
+		// Leave a hole every third entry
+		if (i % 3) {
+			derived1_owners.emplace_back(std::make_unique<derived1>(static_cast<float>(i)));
+		} else {
+			derived1_owners.emplace_back(nullptr);
+		}
+		derived2_vector.emplace_back(static_cast<float>(i));
+		derived2_pointers.push_back(&derived2_vector.back());
+	}
+
+	// Printing derived1_owners, skipping the holes //
+	Iterator<base> derived1_owners_begin = MakeIteratorIndirect<base>(derived1_owners.begin(), derived1_owners.end());
+	Iterator<base> derived1_owners_end = MakeIteratorIndirect<base>(derived1_owners.end(), derived1_owners.end());
+
+	std::cout << "Derived1_Owners:" << std::endl;
+	for (; derived1_owners_begin != derived1_owners_end; ++derived1_owners_begin) {
+		std::cout << "(" << derived1_owners_begin->getInt() << ", " << (*derived1_owners_begin).getfloat() << ")\t";
+	}
+	std::cout << std::endl;
+
+	// Printing derived2_pointers //
+	Iterator<const base> derived2_pointers_begin = MakeIteratorIndirect<const base>(derived2_pointers.cbegin());
+	Iterator<const base> derived2_pointers_end = MakeIteratorIndirect<const base>(derived2_pointers.cend());
+
+	std::cout << "Derived2_Pointers:" << std::endl;
+	ForEach(derived2_pointers_begin, derived2_pointers_end, [](const base &rhs) {
+		std::cout << "(" << rhs.getInt() << ", " << rhs.getfloat() << ")\t";
+	});
+	std::cout << std::endl;
+
+	// Benchmarking //
+
+	// Objects allocated one at a time and visited in a random order,
+	// so every dereference is a likely cache miss
+	const int count = 1 << 20;
+	std::vector<std::unique_ptr<derived1>> scattered;
+	scattered.reserve(count);
+	for (int i = 0; i < count; ++i) {
+		scattered.emplace_back(i % 7 ? std::make_unique<derived1>(static_cast<float>(i % 100)) : nullptr);
+	}
+	std::shuffle(scattered.begin(), scattered.end(), std::mt19937(42));
+
+	Iterator<base> scattered_begin = MakeIteratorIndirect<base>(scattered.begin(), scattered.end());
+	Iterator<base> scattered_end = MakeIteratorIndirect<base>(scattered.end(), scattered.end());
+	float sums[2] = {};
+
+	double time = Benchmark(5, [&]() {
+		float sum = 0.f;
+		for (Iterator<base> it(scattered_begin); it != scattered_end; ++it) {
+			sum += it->getfloat();
+		}
+		sums[0] = sum;
+	});
+	Report("unique_ptr Iterator<base> loop", time, count, count * sizeof(derived1));
+
+	time = Benchmark(5, [&]() {
+		float sum = 0.f;
+		ForEach(scattered_begin, scattered_end, [&sum](const base &rhs) {
+			sum += rhs.getfloat();
+		});
+		sums[1] = sum;
+	});
+	Report("unique_ptr ForEach with prefetch", time, count, count * sizeof(derived1));
+
+	KeepAlive(sums[0] + sums[1]);
+	// Iterators made without an end do not skip holes with operator++,
+	// but ForEach and Scan still pass over them
+	const Iterator<base> holes_begin = MakeIteratorIndirect<base>(scattered.begin());
+	const Iterator<base> holes_end = MakeIteratorIndirect<base>(scattered.end());
+	std::size_t live = 0;
+	std::size_t visited[2] = {};
+	for (const std::unique_ptr<derived1> &owner : scattered) {
+		live += owner != nullptr;
+	}
+	ForEach(holes_begin, holes_end, [&visited](const base &) {
+		++visited[0];
+	});
+	holes_begin.Scan(holes_end, [&visited](base &, std::size_t) {
+		++visited[1];
+		return true;
+	});
+
+	if (sums[0] != sums[1] || visited[0] != live || visited[1] != live) {
+		std::cout << "Sums do not match" << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
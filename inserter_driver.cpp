@@ -0,0 +1,181 @@
+/*!
+ * @file inserter_driver.cpp
+ * @author Saadiq Daniels
+ * @date 18/10/2026
+ * @version 1.0
+ */
+
+#include <iostream>
+#include <list>
+#include <map>
+#include <memory>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include "iterator.h"
+#include "iterator_inserter.h"
+#include "base.h"
+#include "benchmark.h"
+
+/*!
+ * The README's Container, with a virtual call for every element added or removed
+ */
+class Container
+{
+public:
+	virtual ~Container() = default;
+	virtual void Add(float number) = 0;
+	virtual void Remove(int id) = 0;
+	virtual Range<const base> All() = 0;
+};
+
+/*!
+ * A Container backed by a hash table keyed by id
+ */
+class HashContainer : public Container
+{
+public:
+	std::unordered_map<int, derived4> data;
+
+	void Add(float number) override {
+
+		derived4 component(number);
+		data.emplace(component.getInt(), component);
+	}
+
+	void Remove(int id) override {
+
+		data.erase(id);
+	}
+
+	Range<const base> All() override {
+
+		return MakeRangeRight<const base>(data);
+	}
+};
+
+/*!
+ * Tests adding and removing batches of elements through a type erased container
+ * @return 0, or 1 if the containers do not agree
+ */
+int main() {
+
+	const std::size_t count = 1 << 19;
+	const auto key_of = [](const derived4 &rhs) {
+		return rhs.getInt();
+	};
+	const auto number_of = [](std::size_t i) {
+		return std::tuple<float>(static_cast<float>(i % 100));
+	};
+	// Removes the elements below 10, a tenth of them
+	const auto small = [](const base &rhs) {
+		return rhs.getfloat() < 10.f;
+	};
+	std::vector<std::tuple<float>> arguments;
+	for (std::size_t i = 0; i < count; ++i) {
+		arguments.push_back(number_of(i));
+	}
+
+	// Adding //
+
+	std::size_t sizes[5] = {};
+	double time = Benchmark(3, [&]() {
+		std::unique_ptr<Container> container = std::make_unique<HashContainer>();
+		for (std::size_t i = 0; i < count; ++i) {
+			container->Add(static_cast<float>(i % 100));
+		}
+		sizes[0] = static_cast<HashContainer &>(*container).data.size();
+	});
+	Report("unordered_map, virtual Add per element", time, count, count * sizeof(derived4));
+
+	time = Benchmark(3, [&]() {
+		std::unordered_map<int, derived4> derived4_hash;
+		sizes[1] = MakeInserterRight<const base, float>(derived4_hash, key_of)->Emplace(arguments);
+	});
+	Report("unordered_map, Inserter Emplace", time, count, count * sizeof(derived4));
+
+	time = Benchmark(3, [&]() {
+		std::unordered_map<int, derived4> derived4_hash;
+		sizes[2] = MakeInserterRight<const base, float>(derived4_hash, key_of)->Generate(count, number_of);
+	});
+	Report("unordered_map, Inserter Generate", time, count, count * sizeof(derived4));
+
+	time = Benchmark(3, [&]() {
+		std::vector<derived4> derived4_vector;
+		auto inserter = MakeInserter<base, float>(derived4_vector);
+		// Many small batches still grow the vector geometrically
+		for (std::size_t i = 0; i < count; i += 64) {
+			inserter->Emplace(arguments.data() + i, 64);
+		}
+		sizes[3] = inserter->Size();
+	});
+	Report("vector, Inserter Emplace, batches of 64", time, count, count * sizeof(derived4));
+
+	time = Benchmark(3, [&]() {
+		std::map<derived4, int> derived4_map;
+		sizes[4] = MakeInserterLeft<const base, float>(derived4_map)->Generate(count, number_of);
+	});
+	Report("map (Left), Inserter Generate", time, count, count * sizeof(derived4));
+
+	// Removing //
+
+	std::size_t removed[4] = {};
+	HashContainer hashed;
+	std::unordered_map<int, derived4> derived4_hash;
+	std::vector<derived4> derived4_vector;
+	std::list<derived4> derived4_list;
+	std::map<derived4, int> derived4_map;
+
+	time = Benchmark(1, [&]() {
+		for (std::size_t i = 0; i < count; ++i) {
+			hashed.Add(static_cast<float>(i % 100));
+		}
+		// Find the matches through the type erased range, then remove each one by id
+		std::vector<int> ids;
+		ForEach(hashed.All(), [&ids, &small](const base &rhs) {
+			if (small(rhs)) {
+				ids.push_back(rhs.getInt());
+			}
+		});
+		for (int id : ids) {
+			hashed.Remove(id);
+		}
+		removed[0] = ids.size();
+	});
+	Report("unordered_map, add then Remove per match", time, count, count * sizeof(derived4));
+
+	time = Benchmark(1, [&]() {
+		auto inserter = MakeInserterRight<const base, float>(derived4_hash, key_of);
+		inserter->Generate(count, number_of);
+		removed[1] = inserter->EraseIf(small);
+	});
+	Report("unordered_map, Generate then EraseIf", time, count, count * sizeof(derived4));
+
+	const std::unique_ptr<Inserter<const base, float>> inserters[] = {
+			MakeInserter<const base, float>(derived4_vector),
+			MakeInserter<const base, float>(derived4_list),
+			MakeInserterLeft<const base, float>(derived4_map)};
+	for (const std::unique_ptr<Inserter<const base, float>> &inserter : inserters) {
+		inserter->Generate(count, number_of);
+		removed[2] += inserter->EraseIf(small);
+		removed[3] += inserter->Size();
+	}
+
+	std::cout << "Sizes: " << sizes[0] << " " << sizes[1] << " " << sizes[2] << " " << sizes[3] << " " << sizes[4]
+	          << ", removed " << removed[0] << " " << removed[1] << " " << removed[2] << std::endl;
+	bool same = removed[0] == removed[1] && removed[2] == removed[0] * 3 && removed[3] == (count - removed[0]) * 3 &&
+	            hashed.data.size() == derived4_hash.size();
+	for (std::size_t size : sizes) {
+		same = same && size == count;
+	}
+	ForEach(MakeRange<const base>(derived4_vector), [&same, &small](const base &rhs) {
+		same = same && !small(rhs);
+	});
+	if (!same) {
+		std::cout << "Containers do not match" << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
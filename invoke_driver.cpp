@@ -0,0 +1,120 @@
+/*!
+ * @file invoke_driver.cpp
+ * @author Saadiq Daniels
+ * @date 18/10/2026
+ * @version 1.0
+ */
+
+#include <iostream>
+#include <list>
+#include <vector>
+
+#include "iterator.h"
+#include "base.h"
+#include "benchmark.h"
+
+/*!
+ * Counts the calls made to doNothing on every element of a container
+ * @param container The container of derived4 objects
+ * @return The total number of calls
+ */
+template<typename Container>
+long Calls(const Container &container) {
+
+	long calls = 0;
+	for (const derived4 &element : container) {
+		calls += element.getCalls();
+	}
+	return calls;
+}
+
+/*!
+ * Tests calling a method on every element of a range with InvokeAll and ForEachKnown
+ * @return 0
+ */
+int main() {
+
+	// Creating data //
+
+	const int count = 1 << 20;
+	const int runs = 5;
+	std::vector<derived4> derived4_vector;
+	std::list<derived4> derived4_list;
+	derived4_vector.reserve(count);
+	for (int i = 0; i < count; ++i) {
+		derived4_vector.emplace_back(static_cast<float>(i % 100));
+		derived4_list.emplace_back(static_cast<float>(i % 100));
+	}
+
+	// Calling a method through the wrapped iterators //
+	const Range<base> vector_range = MakeRange<base>(derived4_vector);
+	const Range<base> list_range = MakeRange<base>(derived4_list);
+	std::vector<derived1> derived1_vector;
+	derived1_vector.emplace_back(1.f);
+	derived1_vector.emplace_back(2.f);
+	std::cout << "Derived1_Vector:" << std::endl;
+	InvokeAll(MakeRange<const base>(derived1_vector), &base::doSomething);
+
+	// Benchmarking //
+
+	double time = Benchmark(runs, [&]() {
+		for (Iterator<base> it = vector_range.begin(), end = vector_range.end(); it != end; ++it) {
+			it->doNothing();
+		}
+	});
+	Report("vector Iterator<base> loop", time, count, count * sizeof(derived4));
+
+	time = Benchmark(runs, [&]() {
+		ForEach(vector_range, [](base &rhs) {
+			rhs.doNothing();
+		});
+	});
+	Report("vector ForEach virtual call", time, count, count * sizeof(derived4));
+
+	time = Benchmark(runs, [&]() {
+		InvokeAll(vector_range, &base::doNothing);
+	});
+	Report("vector InvokeAll", time, count, count * sizeof(derived4));
+
+	time = Benchmark(runs, [&]() {
+		InvokeAll(MakeRange<const base>(derived4_vector), &base::doSomething);
+	});
+	Report("vector InvokeAll const", time, count, count * sizeof(derived4));
+
+	time = Benchmark(runs, [&]() {
+		ForEachKnown<derived4>(vector_range, [](auto &rhs) {
+			rhs.doNothing();
+		});
+	});
+	Report("vector ForEachKnown<derived4>", time, count, count * sizeof(derived4));
+
+	time = Benchmark(runs, [&]() {
+		ForEach(list_range, [](base &rhs) {
+			rhs.doNothing();
+		});
+	});
+	Report("list ForEach virtual call", time, count, count * sizeof(derived4));
+
+	time = Benchmark(runs, [&]() {
+		InvokeAll(list_range, &base::doNothing);
+	});
+	Report("list InvokeAll", time, count, count * sizeof(derived4));
+
+	time = Benchmark(runs, [&]() {
+		ForEachKnown<derived4>(list_range, [](auto &rhs) {
+			rhs.doNothing();
+		});
+	});
+	Report("list ForEachKnown<derived4>", time, count, count * sizeof(derived4));
+
+	// Every element should have been called the same number of times //
+	const long vector_calls = Calls(derived4_vector);
+	const long list_calls = Calls(derived4_list);
+	KeepAlive(vector_calls + list_calls);
+	if (vector_calls != 4L * runs * count || list_calls != 3L * runs * count) {
+		std::cout << "Call counts do not match" << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
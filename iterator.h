@@ -11,6 +11,13 @@
 #ifndef TEMPL_ITERATOR_ITERATOR_H
 #define TEMPL_ITERATOR_ITERATOR_H
 
+#include <cstddef>
+#include <deque>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 /*!
  * @brief Takes a type and removes const from that type
  * @tparam T The type to strip const off of
@@ -78,10 +85,161 @@ struct is_pair<std::pair<T, U>&> : std::true_type
 	typedef U second;
 };
 
+/*!
+ * @brief Takes an iterator type and returns true if the elements it walks over
+ * are stored one after another in memory (pointers and std::vector iterators)
+ * @tparam U The iterator type to check
+ */
+template<typename U, typename = void>
+struct is_contiguous_iterator : std::is_pointer<U>
+{
+};
+
+/*!
+ * @brief Takes an iterator type and returns true if the elements it walks over
+ * are stored one after another in memory (pointers and std::vector iterators)
+ * @tparam U The iterator type to check
+ */
+template<typename U>
+struct is_contiguous_iterator<U, std::enable_if_t<!std::is_pointer<U>::value,
+		std::void_t<typename std::iterator_traits<U>::value_type>>>
+{
+private:
+	using V = typename std::iterator_traits<U>::value_type;
+
+	static constexpr bool Check() {
+
+		// std::vector<bool> packs its elements into bits
+		if constexpr(std::is_object<V>::value && !std::is_abstract<V>::value && !std::is_same<V, bool>::value) {
+			return std::is_same<U, typename std::vector<V>::iterator>::value ||
+			       std::is_same<U, typename std::vector<V>::const_iterator>::value;
+		} else {
+			return false;
+		}
+	}
+
+public:
+	static constexpr bool value = Check();
+};
+
+/*!
+ * @brief Takes an iterator type and returns true if it walks over a
+ * std::deque, which stores its elements in a chain of contiguous blocks
+ * @tparam U The iterator type to check
+ */
+template<typename U, typename = void>
+struct is_block_iterator : std::false_type
+{
+};
+
+/*!
+ * @brief Takes an iterator type and returns true if it walks over a
+ * std::deque, which stores its elements in a chain of contiguous blocks
+ * @tparam U The iterator type to check
+ */
+template<typename U>
+struct is_block_iterator<U, std::enable_if_t<!std::is_pointer<U>::value,
+		std::void_t<typename std::iterator_traits<U>::value_type>>>
+{
+private:
+	using V = typename std::iterator_traits<U>::value_type;
+
+	static constexpr bool Check() {
+
+		if constexpr(std::is_object<V>::value && !std::is_abstract<V>::value) {
+			return std::is_same<U, typename std::deque<V>::iterator>::value ||
+			       std::is_same<U, typename std::deque<V>::const_iterator>::value;
+		} else {
+			return false;
+		}
+	}
+
+public:
+	static constexpr bool value = Check();
+};
+
+/*!
+ * @brief Takes an element type and gives the most elements a std::deque of
+ * it keeps in one block
+ * @details
+ *      Only libstdc++ and libc++ are known, any other standard library gives
+ *      1, which is always safe but makes every element its own block
+ * @tparam V The element type
+ */
+template<typename V>
+struct deque_block_size
+{
+#if defined(__GLIBCXX__)
+	static constexpr std::size_t value = std::__deque_buf_size(sizeof(V));
+#elif defined(_LIBCPP_VERSION)
+	static constexpr std::size_t value = std::__deque_block_size<V, std::ptrdiff_t>::value;
+#else
+	static constexpr std::size_t value = 1;
+#endif
+};
+
+/*!
+ * @brief Takes a container type and returns true if it has reserve, like std::vector
+ * @tparam C The container type to check
+ */
+template<typename C, typename = void>
+struct has_reserve : std::false_type
+{
+};
+
+/*!
+ * @brief Takes a container type and returns true if it has reserve, like std::vector
+ * @tparam C The container type to check
+ */
+template<typename C>
+struct has_reserve<C, std::void_t<decltype(std::declval<C &>().reserve(std::size_t()))>> : std::true_type
+{
+};
+
+/*!
+ * @brief Takes a type and returns true if it is a pointer or smart pointer
+ * to a T, like the elements of std::vector< std::unique_ptr< derived > >
+ * @tparam P The type to check
+ * @tparam T The base type
+ */
+template<typename P, typename T, typename = void>
+struct is_pointer_to : std::false_type
+{
+};
+
+/*!
+ * @brief Takes a type and returns true if it is a pointer or smart pointer
+ * to a T, like the elements of std::vector< std::unique_ptr< derived > >
+ * @tparam P The type to check
+ * @tparam T The base type
+ */
+template<typename P, typename T>
+struct is_pointer_to<P, T, std::void_t<decltype(&*std::declval<P &>())>>
+		: std::is_convertible<decltype(&*std::declval<P &>()), T *>
+{
+};
+
+// The number of element addresses fetched by each batched call
+#ifndef ITERATOR_BATCH_SIZE
+#define ITERATOR_BATCH_SIZE 64
+#endif
+
+/*!
+ * @brief Asks the CPU to start loading an address into cache,
+ * does nothing on compilers without a prefetch builtin
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define ITERATOR_PREFETCH(address) __builtin_prefetch(address)
+#else
+#define ITERATOR_PREFETCH(address) ((void)(address))
+#endif
+
 #include "iterator_base.h"
 #include "iterator_wrapper.h"
 #include "iterator_wrapper_left.h"
 #include "iterator_wrapper_right.h"
+#include "iterator_wrapper_indirect.h"
+#include "iterator_range.h"
 
 /*!
  * @brief Creates an iterator
@@ -124,4 +282,94 @@ Iterator<T> MakeIteratorRight(const U &iterator) {
 	return static_cast<Iterator<T>>(*new IteratorWrapperRight<T, U>(iterator));
 }
 
+/*!
+ * @brief Creates an iterator, should be used on containers of pointers
+ * that look like std::vector< base_type * > or std::vector< std::unique_ptr< base_type > >
+ * @tparam T The base type (must be specified)
+ * @tparam U The derived iterator type (can be deduced) (vector.begin())
+ * @param iterator The iterator to store internally
+ * @return A new iterator
+ */
+template<typename T, typename U>
+Iterator<T> MakeIteratorIndirect(const U &iterator) {
+
+	return static_cast<Iterator<T>>(*new IteratorWrapperIndirect<T, U>(iterator));
+}
+
+/*!
+ * @brief Creates an iterator that skips null entries, should be used on containers of pointers
+ * that look like std::vector< base_type * > or std::vector< std::unique_ptr< base_type > >
+ * @tparam T The base type (must be specified)
+ * @tparam U The derived iterator type (can be deduced) (vector.begin())
+ * @param iterator The iterator to store internally
+ * @param last The end of the container (vector.end()), null entries are skipped up to here
+ * @return A new iterator
+ */
+template<typename T, typename U>
+Iterator<T> MakeIteratorIndirect(const U &iterator, const U &last) {
+
+	return static_cast<Iterator<T>>(*new IteratorWrapperIndirect<T, U>(iterator, last));
+}
+
+#include "iterator_split.h"
+
+/*!
+ * @brief Creates a range covering a whole container
+ * @tparam T The base type (must be specified)
+ * @tparam C The container type (can be deduced)
+ * @param container The container to cover
+ * @return A range from container.begin() to container.end()
+ */
+template<typename T, typename C>
+Range<T> MakeRange(C &container) {
+
+	return Range<T>(MakeIterator<T>(container.begin()), MakeIterator<T>(container.end()));
+}
+
+/*!
+ * @brief Creates a range covering a whole pair based container
+ * that looks like std::map< base_type , other_type >
+ * @tparam T The base type (must be specified)
+ * @tparam C The container type (can be deduced)
+ * @param container The container to cover
+ * @return A range from container.begin() to container.end()
+ */
+template<typename T, typename C>
+Range<T> MakeRangeLeft(C &container) {
+
+	return Range<T>(MakeIteratorLeft<T>(container.begin()), MakeIteratorLeft<T>(container.end()),
+	                MakeSplitter<T, true>(container));
+}
+
+/*!
+ * @brief Creates a range covering a whole pair based container
+ * that looks like std::map< other_type , base_type >
+ * @tparam T The base type (must be specified)
+ * @tparam C The container type (can be deduced)
+ * @param container The container to cover
+ * @return A range from container.begin() to container.end()
+ */
+template<typename T, typename C>
+Range<T> MakeRangeRight(C &container) {
+
+	return Range<T>(MakeIteratorRight<T>(container.begin()), MakeIteratorRight<T>(container.end()),
+	                MakeSplitter<T, false>(container));
+}
+
+/*!
+ * @brief Creates a range covering a whole container of pointers, skipping null entries
+ * @tparam T The base type (must be specified)
+ * @tparam C The container type (can be deduced)
+ * @param container The container to cover
+ * @return A range from container.begin() to container.end()
+ */
+template<typename T, typename C>
+Range<T> MakeRangeIndirect(C &container) {
+
+	return Range<T>(MakeIteratorIndirect<T>(container.begin(), container.end()),
+	                MakeIteratorIndirect<T>(container.end(), container.end()));
+}
+
+#include "iterator_algorithm.h"
+
 #endif //TEMPL_ITERATOR_ITERATOR_H
\ No newline at end of file
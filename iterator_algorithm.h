@@ -0,0 +1,468 @@
+/*!
+ * @file iterator_algorithm.h
+ * @author Saadiq Daniels
+ * @date 18/10/2026
+ * @version 1.0
+ * @brief
+ * 	Algorithms that walk Iterator<T> ranges through the batched interface,
+ * 	paying for the virtual calls once per batch instead of once per element
+ */
+
+#ifndef TEMPL_ITERATOR_ITERATOR_ALGORITHM_H
+#define TEMPL_ITERATOR_ITERATOR_ALGORITHM_H
+
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+
+#include "iterator_base.h"
+#include "iterator_range.h"
+
+/*!
+ * @brief Calls a function on every element between two iterators
+ * @details
+ *      Works like std::for_each, but the function is called from a tight
+ *      loop over a batch of addresses, so it can be inlined
+ * @tparam T The base type
+ * @tparam F The function type (can be deduced)
+ * @param begin The first element to visit
+ * @param end The iterator to stop at
+ * @param function Called with a T & for every element
+ * @return The function, after it has visited every element
+ */
+template<typename T, typename F>
+F ForEach(const Iterator<T> &begin, const Iterator<T> &end, F function) {
+
+	Iterator<T> current(begin);
+	typename Iterator<T>::pointer batch[ITERATOR_BATCH_SIZE];
+	std::size_t count;
+	while ((count = current.Batch(batch, ITERATOR_BATCH_SIZE, end)) != 0) {
+		for (std::size_t i = 0; i < count; ++i) {
+			function(*batch[i]);
+		}
+	}
+	return function;
+}
+
+/*!
+ * @brief Calls a function on every element of a range
+ * @tparam T The base type
+ * @tparam F The function type (can be deduced)
+ * @param range The range to visit
+ * @param function Called with a T & for every element
+ * @return The function, after it has visited every element
+ */
+template<typename T, typename F>
+F ForEach(const Range<T> &range, F function) {
+
+	return ForEach(range.begin(), range.end(), function);
+}
+
+/*!
+ * @brief Calls a function on every run of evenly spaced elements between two iterators
+ * @details
+ *      Containers that keep their elements in blocks hand over a whole block
+ *      per call, so the function can loop over it without any virtual calls
+ * @tparam T The base type
+ * @tparam F The function type (can be deduced)
+ * @param begin The first element to visit
+ * @param end The iterator to stop at
+ * @param function Called with a Span<T> for every run
+ * @return The function, after it has visited every run
+ */
+template<typename T, typename F>
+F ForEachSegment(const Iterator<T> &begin, const Iterator<T> &end, F function) {
+
+	Iterator<T> current(begin);
+	Span<T> segments[ITERATOR_BATCH_SIZE];
+	std::size_t count;
+	while ((count = current.Segments(segments, ITERATOR_BATCH_SIZE, end)) != 0) {
+		for (std::size_t i = 0; i < count; ++i) {
+			function(segments[i]);
+		}
+	}
+	return function;
+}
+
+/*!
+ * @brief Calls a function on every run of evenly spaced elements in a range
+ * @tparam T The base type
+ * @tparam F The function type (can be deduced)
+ * @param range The range to visit
+ * @param function Called with a Span<T> for every run
+ * @return The function, after it has visited every run
+ */
+template<typename T, typename F>
+F ForEachSegment(const Range<T> &range, F function) {
+
+	return ForEachSegment(range.begin(), range.end(), function);
+}
+
+/*!
+ * @brief Calls a function on every element of a run whose exact type is known
+ * @tparam K The exact type of every element in the run
+ * @tparam T The base type
+ * @tparam F The function type
+ * @param segment The run to visit
+ * @param function Called with a K & for every element
+ */
+template<typename K, typename T, typename F>
+void ForEachInSpan(const Span<T> &segment, F &function) {
+
+	using Object = std::conditional_t<std::is_const<T>::value, const K, K>;
+	for (std::size_t j = 0; j < segment.count; ++j) {
+		function(static_cast<Object &>(segment[j]));
+	}
+}
+
+/*!
+ * @brief Calls a function on every element between two iterators, with the
+ * exact type of the element when it is one of the known types
+ * @details
+ *      Containers that know the exact type of a run of elements (see
+ *      Iterator<T>::Segments) say so once per run. When that type is one of
+ *      K the function is called with a K & for the whole run, otherwise with
+ *      a T &. A generic lambda calling a virtual method then makes a direct
+ *      call, which can be inlined, for the types in K that are final:
+ *      @code
+ *      ForEachKnown<derived4>(begin, end, [](auto &rhs) { rhs.doNothing(); });
+ *      @endcode
+ *      The exact type is only looked up when it changes between runs.
+ * @tparam K The types to hand over as themselves, each derived from T
+ * @tparam T The base type (can be deduced)
+ * @tparam F The function type (can be deduced)
+ * @param begin The first element to visit
+ * @param end The iterator to stop at
+ * @param function Called with a K & or a T & for every element
+ * @return The function, after it has visited every element
+ */
+template<typename... K, typename T, typename F>
+F ForEachKnown(const Iterator<T> &begin, const Iterator<T> &end, F function) {
+
+	static_assert((std::is_base_of<std::remove_const_t<T>, K>::value && ...),
+	              "The known types must derive from T");
+	const std::type_info *const known[] = {&typeid(K)..., nullptr};
+	const auto find = [&known](const std::type_info *type) {
+		std::size_t index = 0;
+		while (index < sizeof...(K) && (!type || *known[index] != *type)) {
+			++index;
+		}
+		return index;
+	};
+	// Node based containers of one exact type are walked in batches of
+	// addresses, which is cheaper than one run per element
+	const std::size_t whole = begin.RandomAccess() ? sizeof...(K) : find(begin.ExactType());
+	if (whole != sizeof...(K)) {
+		std::size_t index = 0;
+		((whole == index++ && (ForEach(begin, end, [&function](T &element) {
+			using Object = std::conditional_t<std::is_const<T>::value, const K, K>;
+			function(static_cast<Object &>(element));
+		}), true)) || ...);
+		return function;
+	}
+	Iterator<T> current(begin);
+	Span<T> segments[ITERATOR_BATCH_SIZE];
+	std::size_t count;
+	// The index into K of the last exact type seen, sizeof...(K) if it is not one of them
+	const std::type_info *resolvedType = nullptr;
+	std::size_t resolved = sizeof...(K);
+	while ((count = current.Segments(segments, ITERATOR_BATCH_SIZE, end)) != 0) {
+		for (std::size_t i = 0; i < count; ++i) {
+			const Span<T> &segment = segments[i];
+			if (segment.type != resolvedType) {
+				resolvedType = segment.type;
+				resolved = find(resolvedType);
+			}
+			std::size_t index = 0;
+			const bool done = ((resolved == index++ && (ForEachInSpan<K>(segment, function), true)) || ...);
+			if (!done) {
+				for (std::size_t j = 0; j < segment.count; ++j) {
+					function(segment[j]);
+				}
+			}
+		}
+	}
+	return function;
+}
+
+/*!
+ * @brief Calls a function on every element of a range, with the exact type
+ * of the element when it is one of the known types
+ * @tparam K The types to hand over as themselves, each derived from T
+ * @tparam T The base type (can be deduced)
+ * @tparam F The function type (can be deduced)
+ * @param range The range to visit
+ * @param function Called with a K & or a T & for every element
+ * @return The function, after it has visited every element
+ */
+template<typename... K, typename T, typename F>
+F ForEachKnown(const Range<T> &range, F function) {
+
+	return ForEachKnown<K...>(range.begin(), range.end(), function);
+}
+
+/*!
+ * @brief Calls a method on every element between two iterators
+ * @details
+ *      A ForEach that calls the method, every call is a virtual call. Use
+ *      ForEachKnown to skip the vtable for final types.
+ *      Anything the method returns is thrown away.
+ * @tparam T The base type
+ * @tparam M The pointer to member function type (can be deduced)
+ * @tparam A The argument types (can be deduced)
+ * @param begin The first element to visit
+ * @param end The iterator to stop at
+ * @param method The method to call, such as &base::doNothing
+ * @param args The arguments to pass to every call
+ * @return The number of elements visited
+ */
+template<typename T, typename M, typename... A>
+std::size_t InvokeAll(const Iterator<T> &begin, const Iterator<T> &end, M method, A &&... args) {
+
+	static_assert(std::is_member_function_pointer<M>::value, "The method must be a pointer to member function");
+	std::size_t visited = 0;
+	ForEach(begin, end, [method, &args..., &visited](T &element) {
+		(element.*method)(args...);
+		++visited;
+	});
+	return visited;
+}
+
+/*!
+ * @brief Calls a method on every element of a range
+ * @tparam T The base type
+ * @tparam M The pointer to member function type (can be deduced)
+ * @tparam A The argument types (can be deduced)
+ * @param range The range to visit
+ * @param method The method to call
+ * @param args The arguments to pass to every call
+ * @return The number of elements visited
+ */
+template<typename T, typename M, typename... A>
+std::size_t InvokeAll(const Range<T> &range, M method, A &&... args) {
+
+	return InvokeAll(range.begin(), range.end(), method, std::forward<A>(args)...);
+}
+
+/*
+ * Overloads of the standard algorithms for Iterator<T>. Each one makes a
+ * single virtual call into the hidden container's iterator and runs the
+ * whole loop there, instead of copying and incrementing Iterator<T>s. Call
+ * them unqualified, std::min_element(begin, end) still uses the standard one.
+ */
+
+/*!
+ * @brief Calls a function on every element, see std::for_each
+ * @tparam T The base type
+ * @tparam F The function type (can be deduced)
+ * @param begin The first element to visit
+ * @param end The iterator to stop at
+ * @param function Called with a T & for every element
+ * @return The function, after it has visited every element
+ */
+template<typename T, typename F>
+F for_each(const Iterator<T> &begin, const Iterator<T> &end, F function) {
+
+	begin.Scan(end, [&function](T &element, std::size_t) {
+		function(element);
+		return true;
+	});
+	return function;
+}
+
+/*!
+ * @brief Finds the first element a predicate accepts, see std::find_if
+ * @tparam T The base type
+ * @tparam P The predicate type (can be deduced)
+ * @param begin The first element to check
+ * @param end The iterator to stop at
+ * @param predicate Called with a T & until it returns true
+ * @return An iterator to the element found, or end
+ */
+template<typename T, typename P>
+Iterator<T> find_if(const Iterator<T> &begin, const Iterator<T> &end, P predicate) {
+
+	bool found = false;
+	const std::size_t distance = begin.Scan(end, [&predicate, &found](T &element, std::size_t) {
+		found = static_cast<bool>(predicate(element));
+		return !found;
+	});
+	return found ? Iterator<T>(begin, static_cast<long>(distance)) : Iterator<T>(end);
+}
+
+/*!
+ * @brief Finds the first smallest element, see std::min_element
+ * @details
+ *      The best element so far is held as an iterator and fetched again for
+ *      every comparison, because the element Scan hands over is only valid
+ *      during its callback: a structure-of-arrays row is a temporary View,
+ *      and a paged container can evict the page it came from. The iterator
+ *      is moved forward to each new best element and never shared, so only
+ *      the first move copies it to the heap.
+ * @tparam T The base type
+ * @tparam C The comparison type (can be deduced)
+ * @param begin The first element to check
+ * @param end The iterator to stop at
+ * @param less Returns true if its first argument is less than its second
+ * @return An iterator to the smallest element, or end if there are no elements
+ */
+template<typename T, typename C>
+Iterator<T> min_element(const Iterator<T> &begin, const Iterator<T> &end, C less) {
+
+	Iterator<T> best(begin);
+	std::size_t bestDistance = 0;
+	bool found = false;
+	// Follows the scan to each new best element, so reaching it is never
+	// more than one pass over the range
+	begin.Scan(end, [&](T &element, std::size_t distance) {
+		if (!found || less(element, *best)) {
+			best.Advance(static_cast<typename Iterator<T>::difference_type>(distance - bestDistance));
+			bestDistance = distance;
+			found = true;
+		}
+		return true;
+	});
+	return found ? best : Iterator<T>(end);
+}
+
+/*!
+ * @brief Finds the first smallest element using operator<, see std::min_element
+ * @tparam T The base type
+ * @param begin The first element to check
+ * @param end The iterator to stop at
+ * @return An iterator to the smallest element, or end if there are no elements
+ */
+template<typename T>
+Iterator<T> min_element(const Iterator<T> &begin, const Iterator<T> &end) {
+
+	return min_element(begin, end, std::less<>());
+}
+
+/*!
+ * @brief Finds the first largest element, see std::max_element
+ * @details
+ *      Works the same as min_element with the comparison reversed
+ * @tparam T The base type
+ * @tparam C The comparison type (can be deduced)
+ * @param begin The first element to check
+ * @param end The iterator to stop at
+ * @param less Returns true if its first argument is less than its second
+ * @return An iterator to the largest element, or end if there are no elements
+ */
+template<typename T, typename C>
+Iterator<T> max_element(const Iterator<T> &begin, const Iterator<T> &end, C less) {
+
+	return min_element(begin, end, [&less](T &lhs, T &rhs) {
+		return less(rhs, lhs);
+	});
+}
+
+/*!
+ * @brief Finds the first largest element using operator<, see std::max_element
+ * @tparam T The base type
+ * @param begin The first element to check
+ * @param end The iterator to stop at
+ * @return An iterator to the largest element, or end if there are no elements
+ */
+template<typename T>
+Iterator<T> max_element(const Iterator<T> &begin, const Iterator<T> &end) {
+
+	return max_element(begin, end, std::less<>());
+}
+
+/*!
+ * @brief Counts the elements a predicate accepts, see std::count_if
+ * @tparam T The base type
+ * @tparam P The predicate type (can be deduced)
+ * @param begin The first element to check
+ * @param end The iterator to stop at
+ * @param predicate Called with a T & for every element
+ * @return The number of elements the predicate returned true for
+ */
+template<typename T, typename P>
+typename Iterator<T>::difference_type count_if(const Iterator<T> &begin, const Iterator<T> &end, P predicate) {
+
+	typename Iterator<T>::difference_type count = 0;
+	begin.Scan(end, [&predicate, &count](T &element, std::size_t) {
+		count += static_cast<bool>(predicate(element));
+		return true;
+	});
+	return count;
+}
+
+/*!
+ * @brief Folds every element into a value, see std::accumulate
+ * @tparam T The base type
+ * @tparam V The value type (can be deduced)
+ * @tparam O The operation type (can be deduced)
+ * @param begin The first element to fold in
+ * @param end The iterator to stop at
+ * @param init The starting value
+ * @param operation Called with the value so far and a T &, returns the next value
+ * @return The final value
+ */
+template<typename T, typename V, typename O>
+V accumulate(const Iterator<T> &begin, const Iterator<T> &end, V init, O operation) {
+
+	begin.Scan(end, [&operation, &init](T &element, std::size_t) {
+		init = operation(std::move(init), element);
+		return true;
+	});
+	return init;
+}
+
+/*!
+ * @brief Adds every element to a value using operator+, see std::accumulate
+ * @tparam T The base type
+ * @tparam V The value type (can be deduced)
+ * @param begin The first element to add
+ * @param end The iterator to stop at
+ * @param init The starting value
+ * @return The final value
+ */
+template<typename T, typename V>
+V accumulate(const Iterator<T> &begin, const Iterator<T> &end, V init) {
+
+	return accumulate(begin, end, std::move(init), std::plus<>());
+}
+
+/*!
+ * @brief Checks if a predicate accepts any element, see std::any_of
+ * @tparam T The base type
+ * @tparam P The predicate type (can be deduced)
+ * @param begin The first element to check
+ * @param end The iterator to stop at
+ * @param predicate Called with a T & until it returns true
+ * @return True if the predicate returned true for an element
+ */
+template<typename T, typename P>
+bool any_of(const Iterator<T> &begin, const Iterator<T> &end, P predicate) {
+
+	bool found = false;
+	begin.Scan(end, [&predicate, &found](T &element, std::size_t) {
+		found = static_cast<bool>(predicate(element));
+		return !found;
+	});
+	return found;
+}
+
+/*!
+ * @brief Checks if a predicate accepts every element, see std::all_of
+ * @tparam T The base type
+ * @tparam P The predicate type (can be deduced)
+ * @param begin The first element to check
+ * @param end The iterator to stop at
+ * @param predicate Called with a T & until it returns false
+ * @return True if the predicate returned true for every element, or there are none
+ */
+template<typename T, typename P>
+bool all_of(const Iterator<T> &begin, const Iterator<T> &end, P predicate) {
+
+	return !any_of(begin, end, [&predicate](T &element) {
+		return !predicate(element);
+	});
+}
+
+#endif //TEMPL_ITERATOR_ITERATOR_ALGORITHM_H
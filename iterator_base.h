@@ -17,6 +17,13 @@
 #ifndef TEMPL_ITERATOR_ITERATOR_BASE_H
 #define TEMPL_ITERATOR_ITERATOR_BASE_H
 
+#include <cstddef>
+#include <type_traits>
+#include <typeinfo>
+
+#include "function_ref.h"
+#include "iterator_span.h"
+
 // Forward declaration of the IteratorWrapper class
 template<typename T, typename U>
 class IteratorWrapper;
@@ -166,6 +173,16 @@ public:
         ++_data->_refCount;
     }
 
+    /*!
+     * @brief Offset constructor, copies an iterator and moves the copy forward
+     * @param rhs The iterator to copy
+     * @param count The number of elements to move the copy forward
+     */
+    Iterator(const Iterator<T> &rhs, difference_type count) noexcept(true): Iterator(rhs) {
+
+        Advance(count);
+    }
+
     /* Examples:
      * --- Setup:
      *
@@ -460,6 +477,102 @@ public:
         return RV;
     }
 
+    /*!
+     * @brief Moves the iterator forward by more than one element
+     * @details
+     *      The steps are taken by the hidden container's iterator, so this
+     *      is one virtual call, and constant time for random access containers
+     * @param count The number of elements to move forward
+     * @return A reference to this iterator
+     */
+    virtual Iterator &Advance(difference_type count) noexcept(true) {
+
+        CopyIf();
+        _data->Advance(count);
+        return *this;
+    }
+
+    /*!
+     * @brief Checks if the hidden container's iterator is random access
+     * @return True if Advance and operator- take constant time
+     */
+    virtual bool RandomAccess() const noexcept(true) {
+
+        return _data->RandomAccess();
+    }
+
+    /*!
+     * @brief Counts the entries this iterator stepped over when it was made
+     * @details
+     *      Only iterators that skip entries, like MakeIteratorIndirect with an
+     *      end, step over any. Adding this to a distance from a range's begin
+     *      gives the distance from the start of the container.
+     * @return The number of entries skipped before the first element
+     */
+    virtual difference_type Skipped() const noexcept(true) {
+
+        return _data->Skipped();
+    }
+
+    /*!
+     * @brief Finds the exact type of every object this iterator walks over
+     * @return The type, or nullptr if it is not known or not the same for every object
+     */
+    virtual const std::type_info *ExactType() const noexcept(true) {
+
+        return _data->ExactType();
+    }
+
+    /*!
+     * @brief Batched increment, writes the addresses of up to count elements
+     * into out and moves this iterator past them
+     * @details
+     *      This is one virtual call for the whole batch instead of three
+     *      (operator!=, operator*, operator++) for every element
+     * @param out The array to write the element addresses into
+     * @param count The size of the out array
+     * @param end The iterator to stop at
+     * @return The number of addresses written, 0 once this iterator reaches end
+     */
+    virtual std::size_t Batch(pointer *out, std::size_t count, const Iterator<T> &end) noexcept(true) {
+
+        CopyIf();
+        return _data->Batch(out, count, *end._data);
+    }
+
+    /*!
+     * @brief Segmented increment, writes up to count runs of elements that are
+     * evenly spaced in memory into out and moves this iterator past them
+     * @details
+     *      A std::vector is one run, containers that are not stored in
+     *      blocks give one run per element
+     * @param out The array to write the runs into
+     * @param count The size of the out array
+     * @param end The iterator to stop at
+     * @return The number of runs written, 0 once this iterator reaches end
+     */
+    virtual std::size_t Segments(Span<T> *out, std::size_t count, const Iterator<T> &end) noexcept(true) {
+
+        CopyIf();
+        return _data->Segments(out, count, *end._data);
+    }
+
+    /*!
+     * @brief Walks from this iterator to end inside the hidden container's own
+     * loop, without moving this iterator
+     * @details
+     *      The whole walk is one virtual call and copies nothing on the heap
+     * @param end The iterator to stop at
+     * @param visit Called with each element and its distance from this iterator,
+     * the walk stops when it returns false
+     * @return The distance to the element the walk stopped at, or to end,
+     * suitable for Advance
+     */
+    virtual std::size_t Scan(const Iterator<T> &end, FunctionRef<bool(T &, std::size_t)> visit) const {
+
+        return _data->Scan(*end._data, visit);
+    }
+
     /*!
      * @brief Copies this iterator
      * @return A new, identical iterator
@@ -469,6 +582,36 @@ public:
         return _data->Copy();
     }
 
+    /*!
+     * @brief Gets the hidden container's iterator, if it is a U
+     * @details
+     *      An Iterator<const foo> cannot hand out an iterator that could
+     *      change the elements, so U must walk const elements when T is const.
+     *      Make it from cbegin() to get the iterator back out.
+     * @tparam U The container iterator type to look for
+     * @return A pointer to the hidden iterator, or nullptr if it is another type
+     */
+    template<typename U>
+    const U *Native() const noexcept(true) {
+
+        static_assert(make_mutable<T>::value ||
+                      std::is_const<std::remove_reference_t<decltype(*std::declval<U &>())>>::value,
+                      "Trying to get a non-const container iterator from a const value_type");
+        return _data ? static_cast<const U *>(_data->NativeAddress(typeid(U))) : nullptr;
+    }
+
+protected:
+
+    /*!
+     * @brief Finds the hidden container's iterator
+     * @param type The type of container iterator to look for
+     * @return The address of the hidden iterator, or nullptr if it is another type
+     */
+    virtual const void *NativeAddress(const std::type_info &type) const noexcept(true) {
+
+        return _data->NativeAddress(type);
+    }
+
 };
 
 #endif //TEMPL_ITERATOR_ITERATOR_BASE_H
@@ -0,0 +1,114 @@
+/*!
+ * @file iterator_cache.h
+ * @author Saadiq Daniels
+ * @date 18/10/2026
+ * @version 1.0
+ * @brief
+ * 	Remembers the element addresses of a node based container, such as a
+ * 	std::map, so that it can be walked again as a flat array of pointers
+ * 	until the container changes
+ */
+
+#ifndef TEMPL_ITERATOR_ITERATOR_CACHE_H
+#define TEMPL_ITERATOR_ITERATOR_CACHE_H
+
+#include <cstddef>
+#include <vector>
+
+#include "iterator.h"
+
+/*!
+ * @brief A flat array of the element addresses of a range, rebuilt when a
+ * generation number changes
+ * @details
+ *      The container cannot say when it has changed, so the owner keeps a
+ *      generation number and adds one to it on every insert or erase. As
+ *      long as the number is the same the saved addresses are walked
+ *      through an indirect iterator, whose Batch prefetches each element,
+ *      instead of following the container's links. Changing an element in
+ *      place does not need a new generation. The array keeps its memory when
+ *      it is rebuilt.
+ * @tparam T The base type
+ */
+template<typename T>
+class IterationCache
+{
+	// The element addresses, in the order the range walks them
+	std::vector<T *> _pointers;
+	// The generation the addresses were saved at
+	std::size_t      _generation;
+	// False until the first walk, and after Invalidate
+	bool             _built;
+
+	/*!
+	 * @brief Saves the element addresses of a range
+	 * @param range The range to walk
+	 */
+	void Build(const Range<T> &range) {
+
+		_pointers.clear();
+		Iterator<T> current = range.begin();
+		const Iterator<T> end = range.end();
+		typename Iterator<T>::pointer batch[ITERATOR_BATCH_SIZE];
+		std::size_t count;
+		while ((count = current.Batch(batch, ITERATOR_BATCH_SIZE, end)) != 0) {
+			_pointers.insert(_pointers.end(), batch, batch + count);
+		}
+	}
+
+public:
+
+	/*!
+	 * @brief Default constructor, the first call to Over walks the container
+	 */
+	IterationCache() noexcept(true) : _generation(0), _built(false) {
+	}
+
+	/*!
+	 * @brief Gets a range over the saved addresses, saving them first if the
+	 * generation has changed
+	 * @param range The range over the container, only walked when the saved
+	 * addresses are out of date
+	 * @param generation The container's current generation number
+	 * @return A range over the same elements in the same order, which stays
+	 * valid until the next call to Over
+	 */
+	Range<T> Over(const Range<T> &range, std::size_t generation) {
+
+		if (!Current(generation)) {
+			Build(range);
+			_generation = generation;
+			_built = true;
+		}
+		return Range<T>(MakeIteratorIndirect<T>(_pointers.begin()), MakeIteratorIndirect<T>(_pointers.end()));
+	}
+
+	/*!
+	 * @brief Checks if the saved addresses can be used
+	 * @param generation The container's current generation number
+	 * @return True if they were saved at this generation
+	 */
+	bool Current(std::size_t generation) const noexcept(true) {
+
+		return _built && _generation == generation;
+	}
+
+	/*!
+	 * @brief Makes the next call to Over walk the container, whatever the generation
+	 */
+	void Invalidate() noexcept(true) {
+
+		_built = false;
+	}
+
+	/*!
+	 * @brief Gets the number of saved addresses
+	 * @return The number of elements at the last rebuild
+	 */
+	std::size_t Size() const noexcept(true) {
+
+		return _pointers.size();
+	}
+};
+
+#endif //TEMPL_ITERATOR_ITERATOR_CACHE_H
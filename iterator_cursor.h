@@ -0,0 +1,151 @@
+/*!
+ * @file iterator_cursor.h
+ * @author Saadiq Daniels
+ * @date 18/10/2026
+ * @version 1.0
+ * @brief
+ * 	A cursor that walks a range a slice at a time, stopping when a time
+ * 	budget runs out and picking up where it stopped on the next call
+ */
+
+#ifndef TEMPL_ITERATOR_ITERATOR_CURSOR_H
+#define TEMPL_ITERATOR_ITERATOR_CURSOR_H
+
+#include <chrono>
+#include <cstddef>
+#include <optional>
+
+#include "iterator.h"
+
+/*!
+ * @brief Remembers how far through a range it got
+ * @details
+ *      For random access containers only a plain index is kept between calls
+ *      to RunFor, so the container can grow or reallocate in between. The
+ *      range is rebuilt from the container for every call and the cursor
+ *      jumps to its saved index in constant time.
+ *      Other containers would have to be walked from the start to reach the
+ *      index, so the cursor keeps the iterator it stopped at instead. Node
+ *      based containers keep their iterators valid while other elements are
+ *      added or removed, but call Reset if the element it stopped at is erased.
+ *      The clock is read at most every ITERATOR_BATCH_SIZE elements, larger
+ *      checkEvery values are lowered to that.
+ * @tparam T The base type
+ */
+template<typename T>
+class Cursor
+{
+	// The index of the next container entry to visit, from the start of the container
+	std::size_t _position;
+	// The number of elements visited between clock checks
+	std::size_t _checkEvery;
+	// Where to start from next time, for containers that are not random access
+	std::optional<Iterator<T>> _resume;
+
+public:
+
+	/*!
+	 * @brief Constructor
+	 * @param checkEvery The number of elements to visit between clock checks,
+	 * capped at ITERATOR_BATCH_SIZE
+	 */
+	explicit Cursor(std::size_t checkEvery = ITERATOR_BATCH_SIZE) noexcept(true)
+			: _position(0), _checkEvery(checkEvery < 1 ? 1 : checkEvery > ITERATOR_BATCH_SIZE ? ITERATOR_BATCH_SIZE : checkEvery) {
+	}
+
+	/*!
+	 * @brief Visits elements of a range until the budget runs out or the range ends
+	 * @details
+	 *      The clock is only read after every checkEvery elements, so the
+	 *      budget can be overrun by up to that many calls to the function
+	 * @tparam Duration A std::chrono::duration (can be deduced)
+	 * @tparam F The function type (can be deduced)
+	 * @param range The range to walk, rebuilt from the container every call
+	 * @param budget The amount of time to spend
+	 * @param function Called with a T & for every element visited
+	 * @return True if the end of the range was reached, the cursor then starts
+	 * over from the beginning on the next call
+	 */
+	template<typename Duration, typename F>
+	bool RunFor(const Range<T> &range, Duration budget, F function) {
+
+		const auto deadline = std::chrono::steady_clock::now() + budget;
+		const Iterator<T> first = range.begin();
+		Iterator<T> current(first);
+		const Iterator<T> end = range.end();
+		const bool randomAccess = current.RandomAccess();
+		// Ranges that skip null entries start past the leading ones, which
+		// can come and go between calls, so positions count from before them
+		const auto skipped = static_cast<std::size_t>(first.Skipped());
+		if (!randomAccess && _resume) {
+			current = *_resume;
+		} else if (_position != 0) {
+			// The container may have shrunk since the last call
+			if (_position >= skipped + static_cast<std::size_t>(current - end)) {
+				Reset();
+				return true;
+			}
+			if (_position > skipped) {
+				current.Advance(static_cast<typename Iterator<T>::difference_type>(_position - skipped));
+			}
+		}
+
+		typename Iterator<T>::pointer batch[ITERATOR_BATCH_SIZE];
+		std::size_t count;
+		while ((count = current.Batch(batch, _checkEvery, end)) != 0) {
+			for (std::size_t i = 0; i < count; ++i) {
+				function(*batch[i]);
+			}
+			// Ranges that skip entries, like MakeRangeIndirect over null
+			// pointers, hand out fewer elements than they pass over
+			_position = randomAccess ? skipped + static_cast<std::size_t>(first - current) : _position + count;
+			if (std::chrono::steady_clock::now() >= deadline) {
+				if (!randomAccess) {
+					_resume.emplace(current);
+				}
+				return false;
+			}
+		}
+		Reset();
+		return true;
+	}
+
+	/*!
+	 * @brief Gets the number of elements visited between clock checks
+	 * @return The checkEvery given to the constructor, capped at ITERATOR_BATCH_SIZE
+	 */
+	std::size_t CheckEvery() const noexcept(true) {
+
+		return _checkEvery;
+	}
+
+	/*!
+	 * @brief Gets the saved position, to store somewhere else
+	 * @return The index of the next container entry to visit, which for random
+	 * access containers counts from the start of the container, skipped entries included
+	 */
+	std::size_t Position() const noexcept(true) {
+
+		return _position;
+	}
+
+	/*!
+	 * @brief Restores a saved position
+	 * @param position The index of the next element to visit
+	 */
+	void Seek(std::size_t position) noexcept(true) {
+
+		_position = position;
+		_resume.reset();
+	}
+
+	/*!
+	 * @brief Starts the next call to RunFor from the beginning of the range
+	 */
+	void Reset() noexcept(true) {
+
+		Seek(0);
+	}
+};
+
+#endif //TEMPL_ITERATOR_ITERATOR_CURSOR_H
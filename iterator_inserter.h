@@ -0,0 +1,382 @@
+/*!
+ * @file iterator_inserter.h
+ * @author Saadiq Daniels
+ * @date 18/10/2026
+ * @version 1.0
+ * @brief
+ * 	The writing side of a type erased container: adds a batch of elements
+ * 	or removes every element that matches, with one virtual call for the
+ * 	whole batch, without knowing what the container is
+ */
+
+#ifndef TEMPL_ITERATOR_ITERATOR_INSERTER_H
+#define TEMPL_ITERATOR_ITERATOR_INSERTER_H
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "iterator.h"
+
+/*!
+ * @brief Takes a container type and returns true if it has its own remove_if, like std::list
+ * @tparam C The container type to check
+ */
+template<typename C, typename = void>
+struct has_remove_if : std::false_type
+{
+};
+
+/*!
+ * @brief Takes a container type and returns true if it has its own remove_if, like std::list
+ * @tparam C The container type to check
+ */
+template<typename C>
+struct has_remove_if<C, std::void_t<decltype(std::declval<C &>().remove_if(
+		std::declval<bool (*)(const typename C::value_type &)>()))>> : std::true_type
+{
+};
+
+/*!
+ * @brief Adds elements to, and removes elements from, a container whose type is hidden
+ * @details
+ *      The element type is hidden too, so elements are described by the
+ *      arguments to their constructor. Each call reserves room once and then
+ *      loops inside the container's own code.
+ * @tparam T The base type
+ * @tparam Args The constructor argument types
+ */
+template<typename T, typename... Args>
+class Inserter
+{
+public:
+	// The arguments for one element
+	using arguments = std::tuple<Args...>;
+
+	/*!
+	 * @brief Default destructor
+	 */
+	virtual ~Inserter() noexcept(true) = default;
+
+	/*!
+	 * @brief Gets the number of elements
+	 * @return The number of elements in the container
+	 */
+	virtual std::size_t Size() const = 0;
+
+	/*!
+	 * @brief Makes room for more elements, if the container can
+	 * @param count The number of elements about to be added
+	 */
+	virtual void Reserve(std::size_t count) = 0;
+
+	/*!
+	 * @brief Adds one element for each set of arguments
+	 * @param args The arguments for each element
+	 * @param count The number of elements to add
+	 * @return The number of elements added, fewer if a keyed container
+	 * already had some of the keys
+	 */
+	virtual std::size_t Emplace(const arguments *args, std::size_t count) = 0;
+
+	/*!
+	 * @brief Adds elements made by a function
+	 * @param count The number of elements to add
+	 * @param make Called with 0 to count - 1, returns the arguments for that element
+	 * @return The number of elements added, fewer if a keyed container
+	 * already had some of the keys
+	 */
+	virtual std::size_t Generate(std::size_t count, FunctionRef<arguments(std::size_t)> make) = 0;
+
+	/*!
+	 * @brief Removes every element that matches, in one pass over the container
+	 * @param predicate Called with each element, returns true to remove it
+	 * @return The number of elements removed
+	 */
+	virtual std::size_t EraseIf(FunctionRef<bool(const T &)> predicate) = 0;
+
+	/*!
+	 * @brief Adds one element for each set of arguments
+	 * @param args The arguments for each element
+	 * @return The number of elements added
+	 */
+	std::size_t Emplace(const std::vector<arguments> &args) {
+
+		return Emplace(args.data(), args.size());
+	}
+};
+
+/*!
+ * @brief Adds elements to the back of a sequence, like std::vector or std::list
+ */
+struct PlaceBack
+{
+	/*!
+	 * @brief Adds an element
+	 * @param container The container to add to
+	 * @param args The element's constructor arguments
+	 */
+	template<typename C, typename... Args>
+	void operator()(C &container, Args &&... args) const {
+
+		container.emplace_back(std::forward<Args>(args)...);
+	}
+
+	/*!
+	 * @brief Finds the object in a stored element
+	 * @param element The element
+	 * @return The element itself
+	 */
+	template<typename V>
+	static const V &Element(const V &element) noexcept(true) {
+
+		return element;
+	}
+};
+
+/*!
+ * @brief Adds elements as the keys of a map, like std::map< base_type , other_type >,
+ * with default constructed values
+ */
+struct PlaceLeft
+{
+	/*!
+	 * @brief Adds an element
+	 * @param container The container to add to
+	 * @param args The key's constructor arguments
+	 */
+	template<typename C, typename... Args>
+	void operator()(C &container, Args &&... args) const {
+
+		container.emplace(std::piecewise_construct, std::forward_as_tuple(std::forward<Args>(args)...),
+		                  std::tuple<>());
+	}
+
+	/*!
+	 * @brief Finds the object in a stored element
+	 * @param element The key and value pair
+	 * @return The key
+	 */
+	template<typename V>
+	static const auto &Element(const V &element) noexcept(true) {
+
+		return element.first;
+	}
+};
+
+/*!
+ * @brief Adds elements as the values of a map, like std::map< other_type , base_type >,
+ * with the key taken from each new value
+ * @tparam KeyOf The type of the function that takes a value and returns its key
+ */
+template<typename KeyOf>
+struct PlaceRight
+{
+	// Gets the key of a value
+	KeyOf keyOf;
+
+	/*!
+	 * @brief Adds an element
+	 * @param container The container to add to
+	 * @param args The value's constructor arguments
+	 */
+	template<typename C, typename... Args>
+	void operator()(C &container, Args &&... args) const {
+
+		typename C::mapped_type value(std::forward<Args>(args)...);
+		auto key = keyOf(value);
+		container.emplace(std::move(key), std::move(value));
+	}
+
+	/*!
+	 * @brief Finds the object in a stored element
+	 * @param element The key and value pair
+	 * @return The value
+	 */
+	template<typename V>
+	static const auto &Element(const V &element) noexcept(true) {
+
+		return element.second;
+	}
+};
+
+/*!
+ * @brief Inserter for a container, with the way elements are added given by Place
+ * @tparam T The base type
+ * @tparam C The container type
+ * @tparam Place PlaceBack, PlaceLeft or PlaceRight
+ * @tparam Args The constructor argument types
+ */
+template<typename T, typename C, typename Place, typename... Args>
+class InserterOf : public Inserter<T, Args...>
+{
+	using arguments = typename Inserter<T, Args...>::arguments;
+
+	// The container to change
+	C     *_container;
+	// Adds one element
+	Place _place;
+
+	/*!
+	 * @brief Adds one element
+	 * @param args The element's constructor arguments
+	 */
+	void Add(const arguments &args) {
+
+		std::apply([this](const Args &... values) {
+			_place(*_container, values...);
+		}, args);
+	}
+
+public:
+
+	/*!
+	 * @brief Conversion constructor
+	 * @param container The container to change
+	 * @param place Adds one element
+	 */
+	InserterOf(C &container, Place place) : _container(&container), _place(std::move(place)) {
+	}
+
+	/*!
+	 * @brief Gets the number of elements
+	 * @return The number of elements in the container
+	 */
+	virtual std::size_t Size() const {
+
+		return _container->size();
+	}
+
+	/*!
+	 * @brief Makes room for more elements, growing a std::vector at least
+	 * geometrically and rehashing a hash table once
+	 * @param count The number of elements about to be added
+	 */
+	virtual void Reserve(std::size_t count) {
+
+		if constexpr(has_reserve<C>::value) {
+			const std::size_t needed = _container->size() + count;
+			if constexpr(is_hashed_container<C>::value) {
+				_container->reserve(needed);
+			} else if (needed > _container->capacity()) {
+				_container->reserve(std::max(needed, _container->capacity() * 2));
+			}
+		} else {
+			static_cast<void>(count);
+		}
+	}
+
+	/*!
+	 * @brief Adds one element for each set of arguments
+	 * @param args The arguments for each element
+	 * @param count The number of elements to add
+	 * @return The number of elements added
+	 */
+	virtual std::size_t Emplace(const arguments *args, std::size_t count) {
+
+		const std::size_t before = _container->size();
+		Reserve(count);
+		for (std::size_t i = 0; i < count; ++i) {
+			Add(args[i]);
+		}
+		return _container->size() - before;
+	}
+
+	/*!
+	 * @brief Adds elements made by a function
+	 * @param count The number of elements to add
+	 * @param make Called with 0 to count - 1, returns the arguments for that element
+	 * @return The number of elements added
+	 */
+	virtual std::size_t Generate(std::size_t count, FunctionRef<arguments(std::size_t)> make) {
+
+		const std::size_t before = _container->size();
+		Reserve(count);
+		for (std::size_t i = 0; i < count; ++i) {
+			Add(make(i));
+		}
+		return _container->size() - before;
+	}
+
+	/*!
+	 * @brief Removes every element that matches, in one pass over the container
+	 * @details
+	 *      Sequences are compacted with remove_if and erased once, node based
+	 *      containers unlink each match as the pass reaches it
+	 * @param predicate Called with each element, returns true to remove it
+	 * @return The number of elements removed
+	 */
+	virtual std::size_t EraseIf(FunctionRef<bool(const T &)> predicate) {
+
+		using value_type = typename C::value_type;
+		const std::size_t before = _container->size();
+		const auto matches = [&predicate](const value_type &element) {
+			return predicate(Place::Element(element));
+		};
+		if constexpr(is_ordered_container<C>::value || is_hashed_container<C>::value) {
+			for (auto it = _container->begin(); it != _container->end();) {
+				if (matches(*it)) {
+					it = _container->erase(it);
+				} else {
+					++it;
+				}
+			}
+		} else if constexpr(has_remove_if<C>::value) {
+			_container->remove_if(matches);
+		} else {
+			_container->erase(std::remove_if(_container->begin(), _container->end(), matches), _container->end());
+		}
+		return before - _container->size();
+	}
+};
+
+/*!
+ * @brief Creates an inserter for a sequence, like std::vector< derived >
+ * @tparam T The base type (must be specified)
+ * @tparam Args The constructor argument types (must be specified)
+ * @tparam C The container type (can be deduced)
+ * @param container The container to change
+ * @return An Inserter that adds elements with emplace_back
+ */
+template<typename T, typename... Args, typename C>
+std::unique_ptr<Inserter<T, Args...>> MakeInserter(C &container) {
+
+	return std::make_unique<InserterOf<T, C, PlaceBack, Args...>>(container, PlaceBack());
+}
+
+/*!
+ * @brief Creates an inserter for a container that looks like std::map< base_type , other_type >
+ * @tparam T The base type (must be specified)
+ * @tparam Args The key's constructor argument types (must be specified)
+ * @tparam C The container type (can be deduced)
+ * @param container The container to change
+ * @return An Inserter that adds keys with default constructed values
+ */
+template<typename T, typename... Args, typename C>
+std::unique_ptr<Inserter<T, Args...>> MakeInserterLeft(C &container) {
+
+	return std::make_unique<InserterOf<T, C, PlaceLeft, Args...>>(container, PlaceLeft());
+}
+
+/*!
+ * @brief Creates an inserter for a container that looks like std::map< other_type , base_type >
+ * @tparam T The base type (must be specified)
+ * @tparam Args The value's constructor argument types (must be specified)
+ * @tparam C The container type (can be deduced)
+ * @tparam KeyOf The key function type (can be deduced)
+ * @param container The container to change
+ * @param keyOf Takes a new value and returns the key to store it under
+ * @return An Inserter that adds values under their own keys
+ */
+template<typename T, typename... Args, typename C, typename KeyOf>
+std::unique_ptr<Inserter<T, Args...>> MakeInserterRight(C &container, KeyOf keyOf) {
+
+	using place_type = PlaceRight<KeyOf>;
+	return std::make_unique<InserterOf<T, C, place_type, Args...>>(container, place_type{std::move(keyOf)});
+}
+
+#endif //TEMPL_ITERATOR_ITERATOR_INSERTER_H
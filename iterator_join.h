@@ -0,0 +1,195 @@
+/*!
+ * @file iterator_join.h
+ * @author Saadiq Daniels
+ * @date 18/10/2026
+ * @version 1.0
+ * @brief
+ * 	Pairs up the elements of two keyed ranges that share a key, such as a
+ * 	physics component and the transform with the same id, without a lookup
+ * 	per element when both ranges are sorted
+ */
+
+#ifndef TEMPL_ITERATOR_ITERATOR_JOIN_H
+#define TEMPL_ITERATOR_ITERATOR_JOIN_H
+
+#include <cstddef>
+#include <functional>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+#include "iterator.h"
+#include "iterator_keyed.h"
+
+/*!
+ * @brief Calls a function on every pair of elements with the same key in two keyed ranges
+ * @details
+ *      The strategy is picked when the join is made. If both ranges are
+ *      Ordered with the same type of comparison (see KeyedRange::Order), the
+ *      smaller one's keys and addresses are read into a buffer with one Walk,
+ *      and the larger one is walked against the buffer in a merge, so there
+ *      are no lookups at all. Keys are compared with operator< for std::less
+ *      and with the buffered range's Less otherwise. Otherwise the smaller range is
+ *      walked and each key is looked up in the larger one with Lookup, which
+ *      uses the container's own find and does not make an iterator. Keys are
+ *      expected to be unique on each side, and the buffer keeps its memory
+ *      between walks.
+ * @tparam T The base type of the left range
+ * @tparam U The base type of the right range
+ * @tparam K The key type
+ */
+template<typename T, typename U, typename K>
+class JoinedRange
+{
+	// The left range
+	KeyedRange<T, K>                _left;
+	// The right range
+	KeyedRange<U, K>                _right;
+	// True to merge, false to look up
+	bool                            _merge;
+	// True if both ranges are sorted with std::less, so the merge can use operator<
+	bool                            _plainLess;
+	// True if the left range is the smaller one
+	bool                            _leftSmaller;
+	// The smaller range's keys and elements, for a merge
+	std::vector<std::pair<K, void *>> _buffer;
+
+	/*!
+	 * @brief Merges one range against the other's buffered keys
+	 * @tparam A The base type of the range that is walked
+	 * @tparam B The base type of the buffered range
+	 * @tparam F The function type
+	 * @param walked The range to walk
+	 * @param buffered The range to buffer
+	 * @param visit Called with the walked element and the buffered element of each pair
+	 */
+	template<typename A, typename B, typename F>
+	void Merge(const KeyedRange<A, K> &walked, const KeyedRange<B, K> &buffered, F &visit) {
+
+		_buffer.clear();
+		buffered.Walk([this](const K &key, B &element) {
+			_buffer.emplace_back(key, const_cast<void *>(static_cast<const void *>(&element)));
+		});
+		if (_plainLess) {
+			MergeBuffer<A, B>(walked, std::less<K>(), visit);
+		} else {
+			MergeBuffer<A, B>(walked, [&buffered](const K &lhs, const K &rhs) {
+				return buffered.Less(lhs, rhs);
+			}, visit);
+		}
+	}
+
+	/*!
+	 * @brief Walks one range against the buffered keys
+	 * @tparam A The base type of the range that is walked
+	 * @tparam B The base type of the buffered range
+	 * @tparam L The comparison type
+	 * @tparam F The function type
+	 * @param walked The range to walk
+	 * @param less The comparison both ranges are sorted with
+	 * @param visit Called with the walked element and the buffered element of each pair
+	 */
+	template<typename A, typename B, typename L, typename F>
+	void MergeBuffer(const KeyedRange<A, K> &walked, L less, F &visit) {
+
+		std::size_t next = 0;
+		const std::size_t size = _buffer.size();
+		walked.Walk([this, &next, size, &less, &visit](const K &key, A &element) {
+			while (next < size && less(_buffer[next].first, key)) {
+				++next;
+			}
+			if (next < size && !less(key, _buffer[next].first)) {
+				visit(element, *static_cast<B *>(_buffer[next].second));
+			}
+		});
+	}
+
+	/*!
+	 * @brief Walks one range and looks up each key in the other
+	 * @tparam A The base type of the range that is walked
+	 * @tparam B The base type of the range that is searched
+	 * @tparam F The function type
+	 * @param walked The range to walk
+	 * @param searched The range to look keys up in
+	 * @param visit Called with the walked element and the found element of each pair
+	 */
+	template<typename A, typename B, typename F>
+	static void Probe(const KeyedRange<A, K> &walked, const KeyedRange<B, K> &searched, F &visit) {
+
+		walked.Walk([&searched, &visit](const K &key, A &element) {
+			if (B *match = searched.Lookup(key)) {
+				visit(element, *match);
+			}
+		});
+	}
+
+public:
+
+	/*!
+	 * @brief Conversion constructor, picks the strategy
+	 * @param left The left range
+	 * @param right The right range, with the same key type
+	 */
+	JoinedRange(KeyedRange<T, K> left, KeyedRange<U, K> right)
+			: _left(std::move(left)), _right(std::move(right)),
+			  _merge(_left.Ordered() && _right.Ordered() && _left.Order() && _right.Order() &&
+			         *_left.Order() == *_right.Order()),
+			  _plainLess(_merge && *_left.Order() == typeid(std::less<K>)),
+			  _leftSmaller(_left.size() <= _right.size()) {
+	}
+
+	/*!
+	 * @brief Calls a function on every pair of elements with the same key
+	 * @details
+	 *      Pairs come in the walked range's order, which is key order for a merge
+	 * @tparam F The function type (can be deduced)
+	 * @param function Called with a T & and a U & for every pair
+	 * @return The function that was passed in
+	 */
+	template<typename F>
+	F ForEach(F function) {
+
+		if (_merge && _leftSmaller) {
+			auto swapped = [&function](U &right, T &left) {
+				function(left, right);
+			};
+			Merge(_right, _left, swapped);
+		} else if (_merge) {
+			Merge(_left, _right, function);
+		} else if (_leftSmaller) {
+			Probe(_left, _right, function);
+		} else {
+			auto swapped = [&function](U &right, T &left) {
+				function(left, right);
+			};
+			Probe(_right, _left, swapped);
+		}
+		return function;
+	}
+
+	/*!
+	 * @brief Checks which strategy the join uses
+	 * @return True if it merges sorted ranges, false if it looks up keys
+	 */
+	bool Merges() const noexcept(true) {
+
+		return _merge;
+	}
+};
+
+/*!
+ * @brief Creates a join of two keyed ranges
+ * @tparam T The base type of the left range (can be deduced)
+ * @tparam U The base type of the right range (can be deduced)
+ * @tparam K The key type (can be deduced)
+ * @param left The left range, such as MakeKeyedRangeRight over a std::map
+ * @param right The right range, with the same key type
+ * @return A JoinedRange that visits every pair with the same key
+ */
+template<typename T, typename U, typename K>
+JoinedRange<T, U, K> MakeJoinedRange(KeyedRange<T, K> left, KeyedRange<U, K> right) {
+
+	return JoinedRange<T, U, K>(std::move(left), std::move(right));
+}
+
+#endif //TEMPL_ITERATOR_ITERATOR_JOIN_H
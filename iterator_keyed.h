@@ -0,0 +1,680 @@
+/*!
+ * @file iterator_keyed.h
+ * @author Saadiq Daniels
+ * @date 18/10/2026
+ * @version 1.0
+ * @brief
+ * 	A range over a keyed container that can also jump to a key or a range
+ * 	of keys, using the container's own lookup, without knowing what the
+ * 	container is
+ */
+
+#ifndef TEMPL_ITERATOR_ITERATOR_KEYED_H
+#define TEMPL_ITERATOR_ITERATOR_KEYED_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+
+#include "iterator.h"
+
+/*!
+ * @brief The interface behind KeyedRange, implemented once for every kind of container
+ * @tparam T The base type
+ * @tparam K The key type
+ */
+template<typename T, typename K>
+class KeyedIndex
+{
+public:
+
+	/*!
+	 * @brief Default destructor
+	 */
+	virtual ~KeyedIndex() noexcept(true) = default;
+
+	/*!
+	 * @brief Gets the whole container as a range
+	 * @return A range from the first element to the end
+	 */
+	virtual Range<T> All() const = 0;
+
+	/*!
+	 * @brief Looks up a key
+	 * @param key The key to look for
+	 * @return An iterator to the element with that key, or the end of the range
+	 */
+	virtual Iterator<T> Find(const K &key) const = 0;
+
+	/*!
+	 * @brief Looks up a key without making an iterator
+	 * @param key The key to look for
+	 * @return The address of the element with that key, or nullptr
+	 */
+	virtual T *Lookup(const K &key) const {
+
+		const Iterator<T> it = Find(key);
+		return it == All().end() ? nullptr : &*it;
+	}
+
+	/*!
+	 * @brief Walks every element with its key, in the container's order
+	 * @param visit Called with each key and element
+	 */
+	virtual void Walk(FunctionRef<void(const K &, T &)> visit) const = 0;
+
+	/*!
+	 * @brief Checks if the elements are sorted by key
+	 * @return True if LowerBound and UpperBound can be used
+	 */
+	virtual bool Ordered() const {
+
+		return false;
+	}
+
+	/*!
+	 * @brief Compares two keys in the order the elements are sorted in
+	 * @param lhs The first key
+	 * @param rhs The second key
+	 * @return True if lhs comes before rhs, always false if the elements are not sorted
+	 */
+	virtual bool Less(const K &lhs, const K &rhs) const {
+
+		static_cast<void>(lhs);
+		static_cast<void>(rhs);
+		return false;
+	}
+
+	/*!
+	 * @brief Gets the type of the comparison the elements are sorted with
+	 * @return The type, such as std::less<K>, or nullptr if the elements are not sorted
+	 */
+	virtual const std::type_info *Order() const {
+
+		return nullptr;
+	}
+
+	/*!
+	 * @brief Finds the first element whose key does not come before a key
+	 * @param key The key to compare with
+	 * @return An iterator to the element, or the end of the range if there is
+	 * none or the elements are not sorted
+	 */
+	virtual Iterator<T> LowerBound(const K &key) const {
+
+		static_cast<void>(key);
+		return All().end();
+	}
+
+	/*!
+	 * @brief Finds the first element whose key comes after a key
+	 * @param key The key to compare with
+	 * @return An iterator to the element, or the end of the range if there is
+	 * none or the elements are not sorted
+	 */
+	virtual Iterator<T> UpperBound(const K &key) const {
+
+		static_cast<void>(key);
+		return All().end();
+	}
+
+	/*!
+	 * @brief Gets the number of elements
+	 * @return The number of elements
+	 */
+	virtual std::size_t Size() const = 0;
+};
+
+/*!
+ * @brief KeyedIndex for a std::map or std::unordered_map like container
+ * @tparam T The base type
+ * @tparam C The container type
+ * @tparam Left True if the base class is the key, false if it is the value
+ */
+template<typename T, typename C, bool Left>
+class KeyedIndexOf : public KeyedIndex<T, typename C::key_type>
+{
+	using key_type = typename C::key_type;
+	using iterator = decltype(std::declval<C &>().begin());
+
+	// The container to look up keys in
+	C *_container;
+
+	/*!
+	 * @brief Wraps one of the container's iterators
+	 * @param it The iterator to wrap
+	 * @return An Iterator<T> pointing at the base class part of the element
+	 */
+	static Iterator<T> Make(const iterator &it) {
+
+		if constexpr(Left) {
+			return MakeIteratorLeft<T>(it);
+		} else {
+			return MakeIteratorRight<T>(it);
+		}
+	}
+
+public:
+
+	/*!
+	 * @brief Conversion constructor
+	 * @param container The container to look up keys in
+	 */
+	explicit KeyedIndexOf(C &container) noexcept(true) : _container(&container) {
+	}
+
+	/*!
+	 * @brief Gets the whole container as a range, with its Splitter
+	 * @return A range from the first element to the end
+	 */
+	virtual Range<T> All() const {
+
+		if constexpr(Left) {
+			return MakeRangeLeft<T>(*_container);
+		} else {
+			return MakeRangeRight<T>(*_container);
+		}
+	}
+
+	/*!
+	 * @brief Looks up a key with the container's find
+	 * @param key The key to look for
+	 * @return An iterator to the element with that key, or the end of the range
+	 */
+	virtual Iterator<T> Find(const key_type &key) const {
+
+		return Make(_container->find(key));
+	}
+
+	/*!
+	 * @brief Looks up a key with the container's find, without making an iterator
+	 * @param key The key to look for
+	 * @return The address of the element with that key, or nullptr
+	 */
+	virtual T *Lookup(const key_type &key) const {
+
+		const iterator it = _container->find(key);
+		if (it == _container->end()) {
+			return nullptr;
+		}
+		if constexpr(Left) {
+			return &it->first;
+		} else {
+			return &it->second;
+		}
+	}
+
+	/*!
+	 * @brief Walks every element with its key, in the container's order
+	 * @param visit Called with each key and element
+	 */
+	virtual void Walk(FunctionRef<void(const key_type &, T &)> visit) const {
+
+		for (auto &element : *_container) {
+			if constexpr(Left) {
+				visit(element.first, element.first);
+			} else {
+				visit(element.first, element.second);
+			}
+		}
+	}
+
+	/*!
+	 * @brief Checks if the container is sorted by key
+	 * @return True for std::map like containers
+	 */
+	virtual bool Ordered() const {
+
+		return is_ordered_container<std::remove_const_t<C>>::value;
+	}
+
+	/*!
+	 * @brief Compares two keys with the container's key_comp
+	 * @param lhs The first key
+	 * @param rhs The second key
+	 * @return True if lhs comes before rhs, always false for unordered containers
+	 */
+	virtual bool Less(const key_type &lhs, const key_type &rhs) const {
+
+		if constexpr(is_ordered_container<std::remove_const_t<C>>::value) {
+			return _container->key_comp()(lhs, rhs);
+		} else {
+			static_cast<void>(lhs);
+			static_cast<void>(rhs);
+			return false;
+		}
+	}
+
+	/*!
+	 * @brief Gets the type of the container's key_comp
+	 * @return The type, or nullptr for unordered containers
+	 */
+	virtual const std::type_info *Order() const {
+
+		if constexpr(is_ordered_container<std::remove_const_t<C>>::value) {
+			return &typeid(typename C::key_compare);
+		} else {
+			return nullptr;
+		}
+	}
+
+	/*!
+	 * @brief Finds the first element whose key does not come before a key with the container's lower_bound
+	 * @param key The key to compare with
+	 * @return An iterator to the element, or the end of the range
+	 */
+	virtual Iterator<T> LowerBound(const key_type &key) const {
+
+		if constexpr(is_ordered_container<std::remove_const_t<C>>::value) {
+			return Make(_container->lower_bound(key));
+		} else {
+			return Make(_container->end());
+		}
+	}
+
+	/*!
+	 * @brief Finds the first element whose key comes after a key with the container's upper_bound
+	 * @param key The key to compare with
+	 * @return An iterator to the element, or the end of the range
+	 */
+	virtual Iterator<T> UpperBound(const key_type &key) const {
+
+		if constexpr(is_ordered_container<std::remove_const_t<C>>::value) {
+			return Make(_container->upper_bound(key));
+		} else {
+			return Make(_container->end());
+		}
+	}
+
+	/*!
+	 * @brief Gets the number of elements
+	 * @return The number of elements
+	 */
+	virtual std::size_t Size() const {
+
+		return _container->size();
+	}
+};
+
+/*!
+ * @brief KeyedIndex for a random access container of objects sorted by a key
+ * taken from each object
+ * @tparam T The base type
+ * @tparam C The container type
+ * @tparam KeyOf The type of the function that takes an element and returns its key
+ */
+template<typename T, typename C, typename KeyOf>
+class KeyedIndexSorted : public KeyedIndex<T, std::decay_t<decltype(std::declval<KeyOf &>()(*std::declval<C &>().begin()))>>
+{
+	using element_type = std::remove_reference_t<decltype(*std::declval<C &>().begin())>;
+	using key_type = std::decay_t<decltype(std::declval<KeyOf &>()(std::declval<element_type &>()))>;
+	using iterator = decltype(std::declval<C &>().begin());
+
+	// The container to search
+	C     *_container;
+	// Gets the key of an element
+	KeyOf _keyOf;
+
+public:
+
+	/*!
+	 * @brief Conversion constructor
+	 * @param container The container to search, sorted by key
+	 * @param keyOf Takes an element and returns its key
+	 */
+	KeyedIndexSorted(C &container, KeyOf keyOf) : _container(&container), _keyOf(std::move(keyOf)) {
+	}
+
+	/*!
+	 * @brief Gets the whole container as a range
+	 * @return A range from the first element to the end
+	 */
+	virtual Range<T> All() const {
+
+		return MakeRange<T>(*_container);
+	}
+
+	/*!
+	 * @brief Looks up a key with a binary search
+	 * @param key The key to look for
+	 * @return An iterator to the first element with that key, or the end of the range
+	 */
+	virtual Iterator<T> Find(const key_type &key) const {
+
+		const iterator it = Lower(key);
+		if (it != _container->end() && !(key < _keyOf(*it))) {
+			return MakeIterator<T>(it);
+		}
+		return MakeIterator<T>(_container->end());
+	}
+
+	/*!
+	 * @brief Looks up a key with a binary search, without making an iterator
+	 * @param key The key to look for
+	 * @return The address of the first element with that key, or nullptr
+	 */
+	virtual T *Lookup(const key_type &key) const {
+
+		const iterator it = Lower(key);
+		if (it != _container->end() && !(key < _keyOf(*it))) {
+			return &*it;
+		}
+		return nullptr;
+	}
+
+	/*!
+	 * @brief Walks every element with its key, in key order
+	 * @param visit Called with each key and element
+	 */
+	virtual void Walk(FunctionRef<void(const key_type &, T &)> visit) const {
+
+		for (element_type &element : *_container) {
+			visit(_keyOf(element), element);
+		}
+	}
+
+	/*!
+	 * @brief Checks if the elements are sorted by key
+	 * @return True
+	 */
+	virtual bool Ordered() const {
+
+		return true;
+	}
+
+	/*!
+	 * @brief Compares two keys with operator<
+	 * @param lhs The first key
+	 * @param rhs The second key
+	 * @return True if lhs is less than rhs
+	 */
+	virtual bool Less(const key_type &lhs, const key_type &rhs) const {
+
+		return lhs < rhs;
+	}
+
+	/*!
+	 * @brief Gets the type of the comparison the elements are sorted with
+	 * @return std::less of the key type
+	 */
+	virtual const std::type_info *Order() const {
+
+		return &typeid(std::less<key_type>);
+	}
+
+	/*!
+	 * @brief Finds the first element whose key is not less than a key with a binary search
+	 * @param key The key to compare with
+	 * @return An iterator to the element, or the end of the range
+	 */
+	virtual Iterator<T> LowerBound(const key_type &key) const {
+
+		return MakeIterator<T>(Lower(key));
+	}
+
+	/*!
+	 * @brief Finds the first element whose key is greater than a key with a binary search
+	 * @param key The key to compare with
+	 * @return An iterator to the element, or the end of the range
+	 */
+	virtual Iterator<T> UpperBound(const key_type &key) const {
+
+		return MakeIterator<T>(std::upper_bound(_container->begin(), _container->end(), key,
+		                                        [this](const key_type &lhs, const element_type &rhs) {
+			                                        return lhs < _keyOf(rhs);
+		                                        }));
+	}
+
+	/*!
+	 * @brief Gets the number of elements
+	 * @return The number of elements
+	 */
+	virtual std::size_t Size() const {
+
+		return _container->size();
+	}
+
+private:
+
+	/*!
+	 * @brief The binary search behind Find and LowerBound
+	 * @param key The key to compare with
+	 * @return The container's iterator to the first element whose key is not less than key
+	 */
+	iterator Lower(const key_type &key) const {
+
+		return std::lower_bound(_container->begin(), _container->end(), key,
+		                        [this](const element_type &lhs, const key_type &rhs) {
+			                        return _keyOf(lhs) < rhs;
+		                        });
+	}
+};
+
+/*!
+ * @brief A range over a keyed container that can jump to a key
+ * @details
+ *      The key type is part of the KeyedRange type, so looking up a key of
+ *      the wrong type does not compile. Lookups take the container's own
+ *      time, O(log n) for a std::map and O(1) for a std::unordered_map.
+ * @tparam T The base type
+ * @tparam K The key type
+ */
+template<typename T, typename K>
+class KeyedRange
+{
+	// The container behind the range
+	std::shared_ptr<const KeyedIndex<T, K>> _index;
+	// The whole container, kept so begin and end are cheap
+	Range<T>                                _all;
+
+public:
+	// User friendly names for data types
+	using key_type = K;
+
+	/*!
+	 * @brief Conversion constructor
+	 * @param index The container behind the range
+	 */
+	explicit KeyedRange(std::shared_ptr<const KeyedIndex<T, K>> index)
+			: _index(std::move(index)), _all(_index->All()) {
+	}
+
+	/*!
+	 * @brief Gets the first element
+	 * @return An iterator to the first element
+	 */
+	Iterator<T> begin() const noexcept(true) {
+
+		return _all.begin();
+	}
+
+	/*!
+	 * @brief Gets the end of the range
+	 * @return An iterator past the last element
+	 */
+	Iterator<T> end() const noexcept(true) {
+
+		return _all.end();
+	}
+
+	/*!
+	 * @brief Gets the whole container as a plain range
+	 * @return The range, which can still be Split
+	 */
+	const Range<T> &All() const noexcept(true) {
+
+		return _all;
+	}
+
+	/*!
+	 * @brief Looks up a key
+	 * @param key The key to look for
+	 * @return An iterator to the element with that key, or end()
+	 */
+	Iterator<T> Find(const K &key) const {
+
+		return _index->Find(key);
+	}
+
+	/*!
+	 * @brief Looks up a key without making an iterator
+	 * @param key The key to look for
+	 * @return The address of the element with that key, or nullptr
+	 */
+	T *Lookup(const K &key) const {
+
+		return _index->Lookup(key);
+	}
+
+	/*!
+	 * @brief Checks if there is an element with a key
+	 * @param key The key to look for
+	 * @return True if the key was found
+	 */
+	bool Contains(const K &key) const {
+
+		return Lookup(key) != nullptr;
+	}
+
+	/*!
+	 * @brief Walks every element with its key, in the container's order,
+	 * with one virtual call
+	 * @param visit Called with each key and element
+	 */
+	void Walk(FunctionRef<void(const K &, T &)> visit) const {
+
+		_index->Walk(visit);
+	}
+
+	/*!
+	 * @brief Checks if the elements are sorted by key, which range queries need
+	 * @return True for sorted maps and sorted random access containers
+	 */
+	bool Ordered() const {
+
+		return _index->Ordered();
+	}
+
+	/*!
+	 * @brief Compares two keys in the order the elements are sorted in, such
+	 * as a std::map's key_comp
+	 * @param lhs The first key
+	 * @param rhs The second key
+	 * @return True if lhs comes before rhs, always false if the elements are not sorted
+	 */
+	bool Less(const K &lhs, const K &rhs) const {
+
+		return _index->Less(lhs, rhs);
+	}
+
+	/*!
+	 * @brief Gets the type of the comparison the elements are sorted with
+	 * @return The type, such as std::less<K>, or nullptr if the elements are not sorted
+	 */
+	const std::type_info *Order() const {
+
+		return _index->Order();
+	}
+
+	/*!
+	 * @brief Finds the first element whose key does not come before a key
+	 * @param key The key to compare with
+	 * @return An iterator to the element, or end() if there is none or the
+	 * elements are not sorted
+	 */
+	Iterator<T> LowerBound(const K &key) const {
+
+		return _index->LowerBound(key);
+	}
+
+	/*!
+	 * @brief Finds the first element whose key comes after a key
+	 * @param key The key to compare with
+	 * @return An iterator to the element, or end() if there is none or the
+	 * elements are not sorted
+	 */
+	Iterator<T> UpperBound(const K &key) const {
+
+		return _index->UpperBound(key);
+	}
+
+	/*!
+	 * @brief Gets the elements whose keys fall in [low, high), in
+	 * O(log n) on a sorted container
+	 * @details
+	 *      The keys are compared in the container's order, so for a
+	 *      std::map with std::greater low is the largest key to include
+	 * @param low The first key to include
+	 * @param high The key to stop before
+	 * @return The range of matching elements, empty if the elements are not
+	 * sorted or high does not come after low
+	 */
+	Range<T> Between(const K &low, const K &high) const {
+
+		if (!Less(low, high)) {
+			return Range<T>(_all.end(), _all.end());
+		}
+		return Range<T>(LowerBound(low), LowerBound(high));
+	}
+
+	/*!
+	 * @brief Gets the number of elements
+	 * @return The number of elements
+	 */
+	std::size_t size() const {
+
+		return _index->Size();
+	}
+};
+
+/*!
+ * @brief Creates a keyed range over a container that looks like
+ * std::map< base_type , other_type >
+ * @tparam T The base type (must be specified)
+ * @tparam C The container type (can be deduced)
+ * @param container The container to cover
+ * @return A KeyedRange whose keys are the base class objects
+ */
+template<typename T, typename C>
+KeyedRange<T, typename C::key_type> MakeKeyedRangeLeft(C &container) {
+
+	return KeyedRange<T, typename C::key_type>(std::make_shared<KeyedIndexOf<T, C, true>>(container));
+}
+
+/*!
+ * @brief Creates a keyed range over a container that looks like
+ * std::map< other_type , base_type >
+ * @tparam T The base type (must be specified)
+ * @tparam C The container type (can be deduced)
+ * @param container The container to cover
+ * @return A KeyedRange with the container's keys
+ */
+template<typename T, typename C>
+KeyedRange<T, typename C::key_type> MakeKeyedRangeRight(C &container) {
+
+	return KeyedRange<T, typename C::key_type>(std::make_shared<KeyedIndexOf<T, C, false>>(container));
+}
+
+/*!
+ * @brief Creates a keyed range over a random access container sorted by key,
+ * such as a sorted std::vector< derived >
+ * @tparam T The base type (must be specified)
+ * @tparam C The container type (can be deduced)
+ * @tparam KeyOf The key function type (can be deduced)
+ * @param container The container to cover, which must stay sorted by key
+ * @param keyOf Takes an element and returns its key
+ * @return A KeyedRange that finds keys with a binary search
+ */
+template<typename T, typename C, typename KeyOf>
+auto MakeKeyedRangeSorted(C &container, KeyOf keyOf) {
+
+	using index_type = KeyedIndexSorted<T, C, KeyOf>;
+	using key_type = std::decay_t<decltype(keyOf(*container.begin()))>;
+	return KeyedRange<T, key_type>(std::make_shared<index_type>(container, std::move(keyOf)));
+}
+
+#endif //TEMPL_ITERATOR_ITERATOR_KEYED_H
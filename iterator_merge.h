@@ -0,0 +1,303 @@
+/*!
+ * @file iterator_merge.h
+ * @author Saadiq Daniels
+ * @date 18/10/2026
+ * @version 1.0
+ * @brief
+ * 	Merges several sorted ranges, such as one std::map per region, into one
+ * 	walk in key order without copying or sorting the elements
+ */
+
+#ifndef TEMPL_ITERATOR_ITERATOR_MERGE_H
+#define TEMPL_ITERATOR_ITERATOR_MERGE_H
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "iterator.h"
+
+/*!
+ * @brief Walks several sorted ranges as one, in order
+ * @details
+ *      Each range is read ITERATOR_BATCH_SIZE elements at a time with
+ *      Batch, and a binary heap of range numbers picks the smallest front
+ *      element, so each step costs O(log k) comparisons for k ranges and
+ *      nothing is allocated after construction. Elements that compare equal
+ *      come out in the order of the ranges they are in. The walk is single
+ *      pass, call Reset to walk again, for example once per frame.
+ * @tparam T The base type
+ * @tparam Compare The type of the function that orders the elements
+ */
+template<typename T, typename Compare = std::less<>>
+class MergedRange
+{
+	/*!
+	 * @brief One of the ranges being merged, with a batch of element addresses read ahead
+	 */
+	struct Source
+	{
+		// The next element to read into the batch
+		Iterator<T> it;
+		// The end of the range
+		Iterator<T> end;
+		// Elements read ahead
+		T           *batch[ITERATOR_BATCH_SIZE];
+		// The front element in batch
+		std::size_t next;
+		// The number of elements in batch
+		std::size_t count;
+
+		/*!
+		 * @brief Conversion constructor
+		 * @param range The range to read
+		 */
+		explicit Source(const Range<T> &range) : it(range.begin()), end(range.end()), next(0), count(0) {
+		}
+
+		/*!
+		 * @brief Gets the front element, reading another batch when this one runs out
+		 * @return The front element, or nullptr once the range is finished
+		 */
+		T *Front() noexcept(true) {
+
+			if (next == count) {
+				next = 0;
+				count = it.Batch(batch, ITERATOR_BATCH_SIZE, end);
+				if (count == 0) {
+					return nullptr;
+				}
+			}
+			return batch[next];
+		}
+	};
+
+	// The ranges to merge
+	std::vector<Range<T>>     _ranges;
+	// The read state of each range
+	std::vector<Source>       _sources;
+	// The numbers of the ranges that still have elements, smallest front element first
+	std::vector<std::size_t>  _heap;
+	// Orders the elements
+	Compare                   _less;
+
+	/*!
+	 * @brief Checks if one range's front element comes before another's
+	 * @param lhs The first range number
+	 * @param rhs The second range number
+	 * @return True if lhs's front element goes first
+	 */
+	bool Before(std::size_t lhs, std::size_t rhs) noexcept(true) {
+
+		const T &left = *_sources[lhs].batch[_sources[lhs].next];
+		const T &right = *_sources[rhs].batch[_sources[rhs].next];
+		if (_less(left, right)) {
+			return true;
+		}
+		return !_less(right, left) && lhs < rhs;
+	}
+
+	/*!
+	 * @brief Moves the heap entry at a position down until the heap is in order
+	 * @param at The position
+	 */
+	void SiftDown(std::size_t at) noexcept(true) {
+
+		const std::size_t size = _heap.size();
+		const std::size_t source = _heap[at];
+		for (;;) {
+			std::size_t child = at * 2 + 1;
+			if (child >= size) {
+				break;
+			}
+			if (child + 1 < size && Before(_heap[child + 1], _heap[child])) {
+				++child;
+			}
+			if (!Before(_heap[child], source)) {
+				break;
+			}
+			_heap[at] = _heap[child];
+			at = child;
+		}
+		_heap[at] = source;
+	}
+
+public:
+
+	/*!
+	 * @brief Conversion constructor
+	 * @param ranges The ranges to merge, each sorted by less
+	 * @param less Orders the elements
+	 */
+	explicit MergedRange(std::vector<Range<T>> ranges, Compare less = Compare())
+			: _ranges(std::move(ranges)), _less(std::move(less)) {
+
+		Reset();
+	}
+
+	/*!
+	 * @brief Goes back to the start of every range, reusing the memory from the last walk
+	 */
+	void Reset() {
+
+		_sources.clear();
+		_sources.reserve(_ranges.size());
+		_heap.clear();
+		for (const Range<T> &range : _ranges) {
+			_sources.emplace_back(range);
+			if (_sources.back().Front()) {
+				_heap.push_back(_sources.size() - 1);
+			}
+		}
+		for (std::size_t at = _heap.size() / 2; at-- > 0;) {
+			SiftDown(at);
+		}
+	}
+
+	/*!
+	 * @brief Checks if every element has been walked over
+	 * @return True if there are no elements left
+	 */
+	bool Empty() const noexcept(true) {
+
+		return _heap.empty();
+	}
+
+	/*!
+	 * @brief Gets the next element in order
+	 * @return A reference to the element, Empty() must be false
+	 */
+	T &Front() const noexcept(true) {
+
+		const Source &source = _sources[_heap.front()];
+		return *source.batch[source.next];
+	}
+
+	/*!
+	 * @brief Moves past the next element in order
+	 */
+	void Pop() noexcept(true) {
+
+		Source &source = _sources[_heap.front()];
+		++source.next;
+		if (!source.Front()) {
+			_heap.front() = _heap.back();
+			_heap.pop_back();
+			if (_heap.empty()) {
+				return;
+			}
+		}
+		SiftDown(0);
+	}
+
+	/*!
+	 * @brief A single pass iterator over a MergedRange
+	 */
+	class iterator
+	{
+		// The range being walked, or nullptr for the end
+		MergedRange *_owner;
+
+	public:
+		// User friendly names for data types
+		using iterator_category = std::input_iterator_tag;
+		using value_type = T;
+		using difference_type = long;
+		using pointer = T *;
+		using reference = T &;
+
+		/*!
+		 * @brief Conversion constructor
+		 * @param owner The range to walk, or nullptr for the end
+		 */
+		explicit iterator(MergedRange *owner) noexcept(true) : _owner(owner) {
+		}
+
+		/*!
+		 * @brief Dereference operator
+		 * @return A reference to the current element
+		 */
+		reference operator*() const noexcept(true) {
+
+			return _owner->Front();
+		}
+
+		/*!
+		 * @brief Arrow operator
+		 * @return A pointer to the current element
+		 */
+		pointer operator->() const noexcept(true) {
+
+			return &_owner->Front();
+		}
+
+		/*!
+		 * @brief Increment operator
+		 * @return A reference to this iterator
+		 */
+		iterator &operator++() noexcept(true) {
+
+			_owner->Pop();
+			return *this;
+		}
+
+		/*!
+		 * @brief Equality operator
+		 * @param rhs The iterator to compare with
+		 * @return True if both are finished, or both walk the same range
+		 */
+		bool operator==(const iterator &rhs) const noexcept(true) {
+
+			const bool done = !_owner || _owner->Empty();
+			const bool rhsDone = !rhs._owner || rhs._owner->Empty();
+			return done == rhsDone && (done || _owner == rhs._owner);
+		}
+
+		/*!
+		 * @brief Inequality operator
+		 * @param rhs The iterator to compare with
+		 * @return False if both are finished, or both walk the same range
+		 */
+		bool operator!=(const iterator &rhs) const noexcept(true) {
+
+			return !(*this == rhs);
+		}
+	};
+
+	/*!
+	 * @brief Gets the next element in order
+	 * @return An iterator that walks the rest of the merge
+	 */
+	iterator begin() noexcept(true) {
+
+		return iterator(this);
+	}
+
+	/*!
+	 * @brief Gets the end of the merge
+	 * @return An iterator that is equal to begin() once every element has been walked
+	 */
+	iterator end() noexcept(true) {
+
+		return iterator(nullptr);
+	}
+};
+
+/*!
+ * @brief Creates a merge of sorted ranges
+ * @tparam T The base type (can be deduced)
+ * @tparam Compare The type of the ordering function (can be deduced)
+ * @param ranges The ranges to merge, each sorted by less, such as MakeRangeLeft
+ * over std::maps
+ * @param less Orders the elements
+ * @return A MergedRange that walks every element in order
+ */
+template<typename T, typename Compare = std::less<>>
+MergedRange<T, Compare> MakeMergedRange(std::vector<Range<T>> ranges, Compare less = Compare()) {
+
+	return MergedRange<T, Compare>(std::move(ranges), std::move(less));
+}
+
+#endif //TEMPL_ITERATOR_ITERATOR_MERGE_H
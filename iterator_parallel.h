@@ -0,0 +1,171 @@
+/*!
+ * @file iterator_parallel.h
+ * @author Saadiq Daniels
+ * @date 18/10/2026
+ * @version 1.0
+ * @brief
+ * 	A small thread pool and a ForEach that walks the pieces of a split
+ * 	range on it at the same time
+ */
+
+#ifndef TEMPL_ITERATOR_ITERATOR_PARALLEL_H
+#define TEMPL_ITERATOR_ITERATOR_PARALLEL_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "iterator.h"
+
+// The number of pieces ParallelForEach cuts a range into for each thread,
+// more pieces even out threads that finish early
+#ifndef ITERATOR_PIECES_PER_THREAD
+#define ITERATOR_PIECES_PER_THREAD 4
+#endif
+
+/*!
+ * @brief A fixed set of worker threads that run batches of tasks
+ */
+class ThreadPool
+{
+	// The worker threads
+	std::vector<std::thread>          _workers;
+	// The tasks waiting for a worker
+	std::deque<std::function<void()>> _tasks;
+	// Guards everything below
+	std::mutex                        _mutex;
+	// Wakes workers when there are tasks or the pool is stopping
+	std::condition_variable           _wake;
+	// Wakes Run when the last task of a batch finishes
+	std::condition_variable           _done;
+	// The number of tasks queued or running
+	std::size_t                       _pending;
+	// True once the destructor has been called
+	bool                              _stopping;
+
+	/*!
+	 * @brief The loop each worker thread runs
+	 */
+	void Work() {
+
+		std::unique_lock<std::mutex> lock(_mutex);
+		for (;;) {
+			_wake.wait(lock, [this]() { return _stopping || !_tasks.empty(); });
+			if (_tasks.empty()) {
+				return;
+			}
+			std::function<void()> task = std::move(_tasks.front());
+			_tasks.pop_front();
+			lock.unlock();
+			task();
+			lock.lock();
+			if (--_pending == 0) {
+				_done.notify_all();
+			}
+		}
+	}
+
+public:
+
+	/*!
+	 * @brief Conversion constructor, starts the worker threads
+	 * @param threads The number of threads, 0 for one per hardware thread
+	 */
+	explicit ThreadPool(std::size_t threads = 0) : _pending(0), _stopping(false) {
+
+		if (threads == 0) {
+			threads = std::thread::hardware_concurrency();
+		}
+		if (threads == 0) {
+			threads = 1;
+		}
+		_workers.reserve(threads);
+		for (std::size_t i = 0; i < threads; ++i) {
+			_workers.emplace_back(&ThreadPool::Work, this);
+		}
+	}
+
+	/*!
+	 * @brief The worker threads cannot be copied
+	 */
+	ThreadPool(const ThreadPool &) = delete;
+
+	/*!
+	 * @brief The worker threads cannot be copied
+	 */
+	ThreadPool &operator=(const ThreadPool &) = delete;
+
+	/*!
+	 * @brief Destructor, finishes the queued tasks and joins the worker threads
+	 */
+	~ThreadPool() {
+
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			_stopping = true;
+		}
+		_wake.notify_all();
+		for (std::thread &worker : _workers) {
+			worker.join();
+		}
+	}
+
+	/*!
+	 * @brief Gets the number of worker threads
+	 * @return The number of worker threads
+	 */
+	std::size_t Size() const noexcept(true) {
+
+		return _workers.size();
+	}
+
+	/*!
+	 * @brief Runs a batch of tasks on the worker threads and waits for all of them
+	 * @details
+	 *      Only one batch should be run at a time
+	 * @param tasks The tasks to run
+	 */
+	void Run(std::vector<std::function<void()>> tasks) {
+
+		std::unique_lock<std::mutex> lock(_mutex);
+		_pending += tasks.size();
+		for (std::function<void()> &task : tasks) {
+			_tasks.push_back(std::move(task));
+		}
+		_wake.notify_all();
+		_done.wait(lock, [this]() { return _pending == 0; });
+	}
+};
+
+/*!
+ * @brief Calls a function on every element of a range from the threads of a pool
+ * @details
+ *      The range is cut up with Range<T>::Split, so hash tables are shared out
+ *      by bucket and sorted maps by key without the caller knowing which it
+ *      has. The function is called from several threads at once, but never
+ *      twice for the same element.
+ * @tparam T The base type
+ * @tparam F The function type (can be deduced)
+ * @param range The range to visit
+ * @param pool The threads to run on
+ * @param function Called with a T & for every element
+ */
+template<typename T, typename F>
+void ParallelForEach(const Range<T> &range, ThreadPool &pool, F function) {
+
+	const std::vector<Range<T>> pieces = range.Split(pool.Size() * ITERATOR_PIECES_PER_THREAD);
+	std::vector<std::function<void()>> tasks;
+	tasks.reserve(pieces.size());
+	for (const Range<T> &piece : pieces) {
+		tasks.emplace_back([&piece, &function]() {
+			ForEach(piece, std::ref(function));
+		});
+	}
+	pool.Run(std::move(tasks));
+}
+
+#endif //TEMPL_ITERATOR_ITERATOR_PARALLEL_H
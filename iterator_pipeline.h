@@ -0,0 +1,329 @@
+/*!
+ * @file iterator_pipeline.h
+ * @author Saadiq Daniels
+ * @date 18/10/2026
+ * @version 1.0
+ * @brief
+ * 	Lazy Filter, Transform, Take and Skip stages that are fused into a
+ * 	single loop over the source when the pipeline is run
+ */
+
+#ifndef TEMPL_ITERATOR_ITERATOR_PIPELINE_H
+#define TEMPL_ITERATOR_ITERATOR_PIPELINE_H
+
+#include <cstddef>
+#include <tuple>
+#include <utility>
+
+#include "iterator.h"
+
+/*
+ * Every stage has a Bind function that takes the sink of the next stage and
+ * returns a sink for this stage. A sink is called with one element and
+ * returns false once nothing more should be sent to it, which lets Take stop
+ * the walk over the source early.
+ */
+
+/*!
+ * @brief Only passes on the elements a predicate returns true for
+ * @tparam P The predicate type
+ */
+template<typename P>
+struct FilterStage
+{
+	P predicate;
+
+	template<typename Sink>
+	auto Bind(Sink sink) const {
+
+		return [predicate = predicate, sink](auto &&element) mutable {
+			if (predicate(element)) {
+				return sink(std::forward<decltype(element)>(element));
+			}
+			return true;
+		};
+	}
+};
+
+/*!
+ * @brief Passes on the result of a function instead of the element
+ * @tparam F The function type
+ */
+template<typename F>
+struct TransformStage
+{
+	F function;
+
+	template<typename Sink>
+	auto Bind(Sink sink) const {
+
+		return [function = function, sink](auto &&element) mutable {
+			return sink(function(std::forward<decltype(element)>(element)));
+		};
+	}
+};
+
+/*!
+ * @brief Passes on the first count elements and then stops the walk
+ */
+struct TakeStage
+{
+	std::size_t count;
+
+	template<typename Sink>
+	auto Bind(Sink sink) const {
+
+		return [remaining = count, sink](auto &&element) mutable {
+			if (remaining == 0) {
+				return false;
+			}
+			--remaining;
+			return sink(std::forward<decltype(element)>(element)) && remaining != 0;
+		};
+	}
+};
+
+/*!
+ * @brief Drops the first count elements
+ */
+struct SkipStage
+{
+	std::size_t count;
+
+	template<typename Sink>
+	auto Bind(Sink sink) const {
+
+		return [remaining = count, sink](auto &&element) mutable {
+			if (remaining != 0) {
+				--remaining;
+				return true;
+			}
+			return sink(std::forward<decltype(element)>(element));
+		};
+	}
+};
+
+/*!
+ * @brief Feeds a pipeline from an Iterator<T> range, a batch at a time
+ * @tparam T The base type
+ */
+template<typename T>
+class RangeSource
+{
+	Range<T> _range;
+
+public:
+
+	explicit RangeSource(const Range<T> &range) noexcept(true) : _range(range) {
+	}
+
+	/*!
+	 * @brief Sends every element to the sink until it returns false
+	 * @param sink The fused stages of the pipeline
+	 */
+	template<typename Sink>
+	void Run(Sink &sink) const {
+
+		Iterator<T> current(_range.begin());
+		const Iterator<T> end(_range.end());
+		typename Iterator<T>::pointer batch[ITERATOR_BATCH_SIZE];
+		std::size_t count;
+		while ((count = current.Batch(batch, ITERATOR_BATCH_SIZE, end)) != 0) {
+			for (std::size_t i = 0; i < count; ++i) {
+				if (!sink(*batch[i])) {
+					return;
+				}
+			}
+		}
+	}
+};
+
+/*!
+ * @brief Feeds a pipeline straight from a container's own iterators,
+ * so there are no virtual calls at all
+ * @tparam U The container iterator type
+ */
+template<typename U>
+class NativeSource
+{
+	U _begin;
+	U _end;
+
+public:
+
+	NativeSource(const U &begin, const U &end) : _begin(begin), _end(end) {
+	}
+
+	/*!
+	 * @brief Sends every element to the sink until it returns false
+	 * @param sink The fused stages of the pipeline
+	 */
+	template<typename Sink>
+	void Run(Sink &sink) const {
+
+		for (U current = _begin; current != _end; ++current) {
+			if (!sink(*current)) {
+				return;
+			}
+		}
+	}
+};
+
+/*!
+ * @brief A source followed by a list of lazy stages
+ * @details
+ *      Nothing happens until a terminal function (ForEach, Count) is called.
+ *      The stages are then nested into one function that is called once per
+ *      source element, so a chain of stages costs one walk over the source.
+ * @tparam Source RangeSource or NativeSource
+ * @tparam Stages The stages, in the order they are applied
+ */
+template<typename Source, typename... Stages>
+class Pipeline
+{
+	Source               _source;
+	std::tuple<Stages...> _stages;
+
+	template<typename Stage>
+	using Then = Pipeline<Source, Stages..., Stage>;
+
+	/*!
+	 * @brief Wraps the terminal sink in every stage from the back to the front
+	 */
+	template<std::size_t I, typename Sink>
+	auto Bind(Sink sink) const {
+
+		if constexpr(I == sizeof...(Stages)) {
+			return sink;
+		} else {
+			return std::get<I>(_stages).Bind(Bind<I + 1>(sink));
+		}
+	}
+
+	/*!
+	 * @brief Runs the pipeline into a terminal sink
+	 */
+	template<typename Sink>
+	void Run(Sink sink) const {
+
+		auto fused = Bind<0>(sink);
+		_source.Run(fused);
+	}
+
+public:
+
+	Pipeline(const Source &source, const std::tuple<Stages...> &stages) : _source(source), _stages(stages) {
+	}
+
+	/*!
+	 * @brief Adds a stage that drops the elements a predicate returns false for
+	 * @param predicate Called with each element
+	 * @return The longer pipeline
+	 */
+	template<typename P>
+	Then<FilterStage<P>> Filter(P predicate) const {
+
+		return Then<FilterStage<P>>(_source, std::tuple_cat(_stages, std::make_tuple(FilterStage<P>{predicate})));
+	}
+
+	/*!
+	 * @brief Adds a stage that replaces each element with the result of a function
+	 * @param function Called with each element
+	 * @return The longer pipeline
+	 */
+	template<typename F>
+	Then<TransformStage<F>> Transform(F function) const {
+
+		return Then<TransformStage<F>>(_source, std::tuple_cat(_stages, std::make_tuple(TransformStage<F>{function})));
+	}
+
+	/*!
+	 * @brief Adds a stage that stops the pipeline after count elements
+	 * @param count The number of elements to pass on
+	 * @return The longer pipeline
+	 */
+	Then<TakeStage> Take(std::size_t count) const {
+
+		return Then<TakeStage>(_source, std::tuple_cat(_stages, std::make_tuple(TakeStage{count})));
+	}
+
+	/*!
+	 * @brief Adds a stage that drops the first count elements
+	 * @param count The number of elements to drop
+	 * @return The longer pipeline
+	 */
+	Then<SkipStage> Skip(std::size_t count) const {
+
+		return Then<SkipStage>(_source, std::tuple_cat(_stages, std::make_tuple(SkipStage{count})));
+	}
+
+	/*!
+	 * @brief Runs the pipeline, calling a function on everything that comes out of it
+	 * @param function Called with each element that reaches the end of the pipeline
+	 * @return The function, after it has visited every element
+	 */
+	template<typename F>
+	F ForEach(F function) const {
+
+		Run([&function](auto &&element) {
+			function(std::forward<decltype(element)>(element));
+			return true;
+		});
+		return function;
+	}
+
+	/*!
+	 * @brief Runs the pipeline, counting what comes out of it
+	 * @return The number of elements that reached the end of the pipeline
+	 */
+	std::size_t Count() const {
+
+		std::size_t count = 0;
+		Run([&count](auto &&) {
+			++count;
+			return true;
+		});
+		return count;
+	}
+};
+
+/*!
+ * @brief Starts a pipeline over an Iterator<T> range
+ * @tparam T The base type (can be deduced)
+ * @param range The range to read from
+ * @return A pipeline with no stages
+ */
+template<typename T>
+Pipeline<RangeSource<T>> From(const Range<T> &range) {
+
+	return Pipeline<RangeSource<T>>(RangeSource<T>(range), std::tuple<>());
+}
+
+/*!
+ * @brief Starts a pipeline over two Iterator<T>s
+ * @tparam T The base type (can be deduced)
+ * @param begin The first element
+ * @param end The iterator to stop at
+ * @return A pipeline with no stages
+ */
+template<typename T>
+Pipeline<RangeSource<T>> From(const Iterator<T> &begin, const Iterator<T> &end) {
+
+	return From(Range<T>(begin, end));
+}
+
+/*!
+ * @brief Starts a pipeline over a container's own iterators, for when the
+ * container type is known and there is no need to go through Iterator<T>
+ * @tparam U The container iterator type (can be deduced) (vector.begin())
+ * @param begin The first element
+ * @param end The iterator to stop at
+ * @return A pipeline with no stages
+ */
+template<typename U>
+Pipeline<NativeSource<U>> From(const U &begin, const U &end) {
+
+	return Pipeline<NativeSource<U>>(NativeSource<U>(begin, end), std::tuple<>());
+}
+
+#endif //TEMPL_ITERATOR_ITERATOR_PIPELINE_H
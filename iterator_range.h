@@ -0,0 +1,149 @@
+/*!
+ * @file iterator_range.h
+ * @author Saadiq Daniels
+ * @date 18/10/2026
+ * @version 1.0
+ * @brief
+ * 	A begin and end Iterator<T> pair that can be passed around as one
+ * 	object and used in a range based for loop
+ */
+
+#ifndef TEMPL_ITERATOR_ITERATOR_RANGE_H
+#define TEMPL_ITERATOR_ITERATOR_RANGE_H
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "iterator_base.h"
+
+template<typename T>
+class Range;
+
+/*!
+ * @brief Cuts a range into pieces that can be walked at the same time
+ * @details
+ *      Ranges over containers that know a better way to share out their
+ *      elements than counting them, such as by hash bucket, carry one
+ * @tparam T The base class of the object type stored in your container
+ */
+template<typename T>
+class Splitter
+{
+public:
+
+	/*!
+	 * @brief Default destructor
+	 */
+	virtual ~Splitter() noexcept(true) = default;
+
+	/*!
+	 * @brief Cuts the range into pieces of about the same size
+	 * @param parts The number of pieces wanted
+	 * @return Up to parts non-empty ranges that cover the whole range between them
+	 */
+	virtual std::vector<Range<T>> Split(std::size_t parts) const = 0;
+};
+
+/*!
+ * @brief A pair of iterators
+ * @tparam T The base class of the object type stored in your container
+ */
+template<typename T>
+class Range
+{
+	// The first element of the range
+	Iterator<T> _begin;
+	// The iterator to stop at
+	Iterator<T>                        _end;
+	// Knows how to cut up the container behind the range, can be null
+	std::shared_ptr<const Splitter<T>> _splitter;
+
+public:
+
+	/*!
+	 * @brief Conversion constructor, takes the two ends of the range
+	 * @param begin The first element of the range
+	 * @param end The iterator to stop at
+	 * @param splitter Cuts the range up for Split, or null to cut it by position
+	 */
+	Range(const Iterator<T> &begin, const Iterator<T> &end,
+	      std::shared_ptr<const Splitter<T>> splitter = nullptr) noexcept(true)
+			: _begin(begin), _end(end), _splitter(std::move(splitter)) {
+	}
+
+	/*!
+	 * @brief Gets the start of the range
+	 * @return A copy of the first iterator
+	 */
+	Iterator<T> begin() const noexcept(true) {
+
+		return Iterator<T>(_begin);
+	}
+
+	/*!
+	 * @brief Gets the end of the range
+	 * @return A copy of the end iterator
+	 */
+	Iterator<T> end() const noexcept(true) {
+
+		return Iterator<T>(_end);
+	}
+
+	/*!
+	 * @brief Checks if the range is empty
+	 * @return True if begin and end are the same
+	 */
+	bool empty() const noexcept(true) {
+
+		return _begin == _end;
+	}
+
+	/*!
+	 * @brief Cuts the range into pieces of about the same size, to hand out to threads
+	 * @details
+	 *      Without a Splitter the range is cut by position, which walks it once
+	 *      unless the container is random access. Iterator<T> copies share a
+	 *      reference count that is not thread safe, so every piece gets its own
+	 *      copies of its iterators and shares nothing with the others or with
+	 *      this range.
+	 * @param parts The number of pieces wanted
+	 * @return Up to parts non-empty ranges that cover the whole range between them
+	 */
+	std::vector<Range<T>> Split(std::size_t parts) const {
+
+		if (_splitter) {
+			return _splitter->Split(parts);
+		}
+		std::vector<Range<T>> pieces;
+		const auto size = static_cast<std::size_t>(_begin - _end);
+		if (parts > size) {
+			parts = size;
+		}
+		if (parts <= 1) {
+			if (size != 0) {
+				pieces.emplace_back(static_cast<Iterator<T>>(*_begin.Copy()), static_cast<Iterator<T>>(*_end.Copy()));
+			}
+			return pieces;
+		}
+		// Each cut starts from the one before, so a list is only walked once
+		std::vector<Iterator<T>> cuts;
+		cuts.reserve(parts + 1);
+		cuts.emplace_back(_begin);
+		for (std::size_t i = 1; i < parts; ++i) {
+			const std::size_t step = size * i / parts - size * (i - 1) / parts;
+			cuts.emplace_back(cuts.back(), static_cast<typename Iterator<T>::difference_type>(step));
+		}
+		cuts.emplace_back(_end);
+		pieces.reserve(parts);
+		// Neighbouring pieces meet at the same cut, each needs its own copy
+		for (std::size_t i = 0; i < parts; ++i) {
+			pieces.emplace_back(static_cast<Iterator<T>>(*cuts[i].Copy()),
+			                    static_cast<Iterator<T>>(*cuts[i + 1].Copy()));
+		}
+		return pieces;
+	}
+};
+
+#endif //TEMPL_ITERATOR_ITERATOR_RANGE_H
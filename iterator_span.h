@@ -0,0 +1,62 @@
+/*!
+ * @file iterator_span.h
+ * @author Saadiq Daniels
+ * @date 18/10/2026
+ * @version 1.0
+ * @brief
+ * 	A run of elements that sit at a fixed distance from each other in
+ * 	memory, handed out by Iterator<T>::Segments
+ */
+
+#ifndef TEMPL_ITERATOR_ITERATOR_SPAN_H
+#define TEMPL_ITERATOR_ITERATOR_SPAN_H
+
+#include <cstddef>
+#include <type_traits>
+#include <typeinfo>
+
+/*!
+ * @brief A run of count elements, stride bytes apart
+ * @details
+ *      For a std::vector< derived > the stride is sizeof(derived), so the
+ *      base class objects of the run can be visited without going back
+ *      through the iterator. When the stride is sizeof(T) the run is a
+ *      plain array of T.
+ * @tparam T The base class type
+ */
+template<typename T>
+struct Span
+{
+	// Byte type with the same const-ness as T, for stepping between elements
+	using byte = std::conditional_t<std::is_const<T>::value, const unsigned char, unsigned char>;
+
+	// The first element of the run
+	T                     *first;
+	// The number of elements in the run
+	std::size_t           count;
+	// The number of bytes from one element to the next
+	std::size_t           stride;
+	// The exact type of every element in the run, or nullptr if it is not known
+	const std::type_info *type;
+
+	/*!
+	 * @brief Gets an element of the run
+	 * @param index The element to get
+	 * @return A reference to the element
+	 */
+	T &operator[](std::size_t index) const noexcept(true) {
+
+		return *reinterpret_cast<T *>(reinterpret_cast<byte *>(first) + index * stride);
+	}
+
+	/*!
+	 * @brief Checks if the run is a plain array of T
+	 * @return True if the elements are sizeof(T) apart
+	 */
+	bool Packed() const noexcept(true) {
+
+		return stride == sizeof(T) || count == 1;
+	}
+};
+
+#endif //TEMPL_ITERATOR_ITERATOR_SPAN_H
@@ -0,0 +1,342 @@
+/*!
+ * @file iterator_split.h
+ * @author Saadiq Daniels
+ * @date 18/10/2026
+ * @version 1.0
+ * @brief
+ * 	Splitters for keyed containers, which share out the elements of a
+ * 	hash table by bucket and of an ordered map by key, without walking them
+ */
+
+#ifndef TEMPL_ITERATOR_ITERATOR_SPLIT_H
+#define TEMPL_ITERATOR_ITERATOR_SPLIT_H
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "iterator_range.h"
+#include "iterator_wrapper_left.h"
+#include "iterator_wrapper_right.h"
+
+/*!
+ * @brief Takes a container type and returns true if it is a hash table
+ * with buckets, like std::unordered_map
+ * @tparam C The container type to check
+ */
+template<typename C, typename = void>
+struct is_hashed_container : std::false_type
+{
+};
+
+/*!
+ * @brief Takes a container type and returns true if it is a hash table
+ * with buckets, like std::unordered_map
+ * @tparam C The container type to check
+ */
+template<typename C>
+struct is_hashed_container<C, std::void_t<typename C::local_iterator,
+		decltype(std::declval<C &>().bucket_size(std::size_t()))>> : std::true_type
+{
+};
+
+/*!
+ * @brief Takes a container type and returns true if it is sorted by key,
+ * like std::map
+ * @tparam C The container type to check
+ */
+template<typename C, typename = void>
+struct is_ordered_container : std::false_type
+{
+};
+
+/*!
+ * @brief Takes a container type and returns true if it is sorted by key,
+ * like std::map
+ * @tparam C The container type to check
+ */
+template<typename C>
+struct is_ordered_container<C, std::void_t<typename C::key_compare,
+		decltype(std::declval<C &>().lower_bound(std::declval<const typename C::key_type &>()))>> : std::true_type
+{
+};
+
+/*!
+ * @brief Walks the elements of a range of hash table buckets
+ * @tparam C The hash table type
+ */
+template<typename C>
+class BucketIterator
+{
+	// The iterator over one bucket
+	using local_iterator = decltype(std::declval<C &>().begin(std::size_t()));
+
+public:
+	// User friendly names for data types
+	using iterator_category = std::forward_iterator_tag;
+	using value_type = typename std::iterator_traits<local_iterator>::value_type;
+	using difference_type = long;
+	using pointer = typename std::iterator_traits<local_iterator>::pointer;
+	using reference = typename std::iterator_traits<local_iterator>::reference;
+
+private:
+	// The hash table being iterated over
+	C              *_container;
+	// The bucket of the current element
+	std::size_t    _bucket;
+	// The bucket to stop at
+	std::size_t    _last;
+	// The current element
+	local_iterator _it;
+
+	/*!
+	 * @brief Moves on to the next bucket with something in it when the current one runs out
+	 */
+	void Settle() noexcept(true) {
+
+		while (_bucket < _last && _it == _container->end(_bucket)) {
+			if (++_bucket < _last) {
+				_it = _container->begin(_bucket);
+			}
+		}
+	}
+
+public:
+
+	/*!
+	 * @brief Conversion constructor
+	 * @param container The hash table to iterate over
+	 * @param bucket The first bucket to walk
+	 * @param last The bucket to stop at
+	 */
+	BucketIterator(C &container, std::size_t bucket, std::size_t last) noexcept(true)
+			: _container(&container), _bucket(bucket), _last(last), _it() {
+
+		if (_bucket < _last) {
+			_it = _container->begin(_bucket);
+			Settle();
+		}
+	}
+
+	/*!
+	 * @brief Dereference operator
+	 * @return A reference to the current element
+	 */
+	reference operator*() const noexcept(true) {
+
+		return *_it;
+	}
+
+	/*!
+	 * @brief Arrow operator
+	 * @return A pointer to the current element
+	 */
+	pointer operator->() const noexcept(true) {
+
+		return &*_it;
+	}
+
+	/*!
+	 * @brief Increment operator
+	 * @return A reference to this iterator
+	 */
+	BucketIterator &operator++() noexcept(true) {
+
+		++_it;
+		Settle();
+		return *this;
+	}
+
+	/*!
+	 * @brief Equality operator
+	 * @param rhs The iterator to compare with
+	 * @return True if both iterators point at the same element, or both are finished
+	 */
+	bool operator==(const BucketIterator &rhs) const noexcept(true) {
+
+		return _bucket == rhs._bucket && (_bucket >= _last || _it == rhs._it);
+	}
+
+	/*!
+	 * @brief Inequality operator
+	 * @param rhs The iterator to compare with
+	 * @return False if both iterators point at the same element
+	 */
+	bool operator!=(const BucketIterator &rhs) const noexcept(true) {
+
+		return !(*this == rhs);
+	}
+};
+
+/*!
+ * @brief Cuts a hash table into runs of buckets holding about the same
+ * number of elements
+ * @tparam T The base type
+ * @tparam C The hash table type
+ */
+template<typename T, typename C>
+class HashSplitter : public Splitter<T>
+{
+	// Wraps a BucketIterator, MakeIteratorLeft or MakeIteratorRight
+	using make_function = Iterator<T> (*)(const BucketIterator<C> &);
+
+	// The hash table to cut up
+	C             *_container;
+	// Makes the Iterator<T>s for each piece
+	make_function _make;
+
+public:
+
+	/*!
+	 * @brief Conversion constructor
+	 * @param container The hash table to cut up
+	 * @param make Makes the Iterator<T>s for each piece
+	 */
+	HashSplitter(C &container, make_function make) noexcept(true) : _container(&container), _make(make) {
+	}
+
+	/*!
+	 * @brief Cuts the hash table into pieces by bucket
+	 * @details
+	 *      Reads every bucket's size once, which is constant time per bucket,
+	 *      and cuts when a piece reaches its share of the elements
+	 * @param parts The number of pieces wanted
+	 * @return Up to parts non-empty ranges that cover the whole table between them
+	 */
+	virtual std::vector<Range<T>> Split(std::size_t parts) const {
+
+		std::vector<Range<T>> pieces;
+		const std::size_t total = _container->size();
+		const std::size_t buckets = _container->bucket_count();
+		if (parts == 0 || total == 0) {
+			return pieces;
+		}
+		std::size_t first = 0;
+		std::size_t seen = 0;
+		std::size_t cut = 0;
+		for (std::size_t bucket = 0; bucket < buckets; ++bucket) {
+			seen += _container->bucket_size(bucket);
+			// Cut once this piece has its share, the last piece takes the rest
+			const bool last = bucket + 1 == buckets;
+			if (last || (pieces.size() + 1 < parts && seen * parts >= total * (pieces.size() + 1))) {
+				if (seen != cut) {
+					pieces.emplace_back(_make(BucketIterator<C>(*_container, first, bucket + 1)),
+					                    _make(BucketIterator<C>(*_container, bucket + 1, bucket + 1)));
+				}
+				first = bucket + 1;
+				cut = seen;
+			}
+		}
+		return pieces;
+	}
+};
+
+/*!
+ * @brief Cuts a sorted map into ranges of keys
+ * @details
+ *      Arithmetic keys are cut at evenly spaced values between the first and
+ *      last key with lower_bound, so the map is never walked. Other keys are
+ *      cut by position, which walks the map once.
+ * @tparam T The base type
+ * @tparam C The map type
+ */
+template<typename T, typename C>
+class OrderedSplitter : public Splitter<T>
+{
+	// The map's own iterator
+	using iterator = decltype(std::declval<C &>().begin());
+	// Wraps a map iterator, MakeIteratorLeft or MakeIteratorRight
+	using make_function = Iterator<T> (*)(const iterator &);
+	using key_type = typename C::key_type;
+
+	// The map to cut up
+	C             *_container;
+	// Makes the Iterator<T>s for each piece
+	make_function _make;
+
+public:
+
+	/*!
+	 * @brief Conversion constructor
+	 * @param container The map to cut up
+	 * @param make Makes the Iterator<T>s for each piece
+	 */
+	OrderedSplitter(C &container, make_function make) noexcept(true) : _container(&container), _make(make) {
+	}
+
+	/*!
+	 * @brief Cuts the map into pieces by key
+	 * @param parts The number of pieces wanted
+	 * @return Up to parts non-empty ranges that cover the whole map between them
+	 */
+	virtual std::vector<Range<T>> Split(std::size_t parts) const {
+
+		std::vector<Range<T>> pieces;
+		const std::size_t total = _container->size();
+		if (parts > total) {
+			parts = total;
+		}
+		if (parts == 0) {
+			return pieces;
+		}
+		std::vector<iterator> cuts;
+		cuts.reserve(parts + 1);
+		cuts.push_back(_container->begin());
+		if constexpr(std::is_arithmetic<key_type>::value) {
+			const long double low = _container->begin()->first;
+			const long double high = std::prev(_container->end())->first;
+			for (std::size_t i = 1; i < parts; ++i) {
+				const auto key = static_cast<key_type>(low + (high - low) * i / parts);
+				cuts.push_back(_container->lower_bound(key));
+			}
+		} else {
+			for (std::size_t i = 1; i < parts; ++i) {
+				cuts.push_back(std::next(cuts.back(), total * i / parts - total * (i - 1) / parts));
+			}
+		}
+		cuts.push_back(_container->end());
+		pieces.reserve(parts);
+		for (std::size_t i = 0; i < parts; ++i) {
+			// Keys that are bunched up can leave a piece empty
+			if (cuts[i] != cuts[i + 1]) {
+				pieces.emplace_back(_make(cuts[i]), _make(cuts[i + 1]));
+			}
+		}
+		return pieces;
+	}
+};
+
+/*!
+ * @brief Makes the Splitter for a pair based container, if it has one
+ * @tparam T The base type (must be specified)
+ * @tparam Left True if the base class is the key, as for MakeIteratorLeft (must be specified)
+ * @tparam C The container type (can be deduced)
+ * @param container The container to cut up
+ * @return A HashSplitter for hash tables, an OrderedSplitter for sorted maps, or null
+ */
+template<typename T, bool Left, typename C>
+std::shared_ptr<const Splitter<T>> MakeSplitter(C &container) {
+
+	if constexpr(is_hashed_container<std::remove_const_t<C>>::value) {
+		using U = BucketIterator<C>;
+		if constexpr(Left) {
+			return std::make_shared<HashSplitter<T, C>>(container, &MakeIteratorLeft<T, U>);
+		} else {
+			return std::make_shared<HashSplitter<T, C>>(container, &MakeIteratorRight<T, U>);
+		}
+	} else if constexpr(is_ordered_container<std::remove_const_t<C>>::value) {
+		using U = decltype(container.begin());
+		if constexpr(Left) {
+			return std::make_shared<OrderedSplitter<T, C>>(container, &MakeIteratorLeft<T, U>);
+		} else {
+			return std::make_shared<OrderedSplitter<T, C>>(container, &MakeIteratorRight<T, U>);
+		}
+	} else {
+		return nullptr;
+	}
+}
+
+#endif //TEMPL_ITERATOR_ITERATOR_SPLIT_H
@@ -0,0 +1,344 @@
+/*!
+ * @file iterator_stride.h
+ * @author Saadiq Daniels
+ * @date 18/10/2026
+ * @version 1.0
+ * @brief
+ * 	Visits every k-th element of a range, or a uniform random sample of it,
+ * 	for level of detail passes that only update part of a container each frame
+ */
+
+#ifndef TEMPL_ITERATOR_ITERATOR_STRIDE_H
+#define TEMPL_ITERATOR_ITERATOR_STRIDE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "iterator.h"
+#include "dirty_set.h"
+
+// Marks the end of the chosen indices
+#ifndef ITERATOR_STRIDE_NONE
+#define ITERATOR_STRIDE_NONE std::numeric_limits<std::size_t>::max()
+#endif
+
+/*!
+ * @brief Calls a function on the elements of a range at increasing indices
+ * @details
+ *      Containers that hand out runs with Segments, like a std::vector (one
+ *      run) or a std::deque (one run per block), are indexed directly.
+ *      Other random access containers, such as a std::vector of pointers,
+ *      jump from one index to the next with one Advance. Node based
+ *      containers still walk every link, but through Batch, and the function
+ *      is only called on the chosen elements.
+ * @tparam T The base type
+ * @tparam Next The type of the function that gives the index after an index
+ * @tparam F The function type
+ * @param range The range to walk
+ * @param index The first index to visit, or ITERATOR_STRIDE_NONE
+ * @param next Takes an index and returns the next, larger one, or ITERATOR_STRIDE_NONE
+ * @param function Called with a T & for every index visited
+ */
+template<typename T, typename Next, typename F>
+void ForEachIndex(const Range<T> &range, std::size_t index, Next next, F &function) {
+
+	Iterator<T> current = range.begin();
+	const Iterator<T> end = range.end();
+	if (index == ITERATOR_STRIDE_NONE || current == end) {
+		return;
+	}
+
+	Span<T> runs[ITERATOR_BATCH_SIZE];
+	Iterator<T> walk(current);
+	std::size_t count = walk.Segments(runs, 1, end);
+	if (runs[0].count == 1 && current.RandomAccess()) {
+		const std::size_t size = static_cast<std::size_t>(current - end);
+		std::size_t at = 0;
+		while (index < size) {
+			current.Advance(static_cast<typename Iterator<T>::difference_type>(index - at));
+			at = index;
+			function(*current);
+			index = next(index);
+		}
+		return;
+	}
+	if (runs[0].count == 1) {
+		typename Iterator<T>::pointer batch[ITERATOR_BATCH_SIZE];
+		std::size_t first = 0;
+		while ((count = current.Batch(batch, ITERATOR_BATCH_SIZE, end)) != 0) {
+			while (index - first < count) {
+				function(*batch[index - first]);
+				index = next(index);
+				if (index == ITERATOR_STRIDE_NONE) {
+					return;
+				}
+			}
+			first += count;
+		}
+		return;
+	}
+
+	// The index of the first element of the current run
+	std::size_t first = 0;
+	while (count != 0) {
+		for (std::size_t i = 0; i < count; ++i) {
+			const Span<T> &run = runs[i];
+			while (index - first < run.count) {
+				function(run[index - first]);
+				index = next(index);
+				if (index == ITERATOR_STRIDE_NONE) {
+					return;
+				}
+			}
+			first += run.count;
+		}
+		count = walk.Segments(runs, ITERATOR_BATCH_SIZE, end);
+	}
+}
+
+/*!
+ * @brief Visits every stride-th element of a range, starting at phase
+ * @details
+ *      Call Rotate after each pass so that, over stride passes, every
+ *      element is visited exactly once
+ * @tparam T The base type
+ */
+template<typename T>
+class StridedRange
+{
+	// The range to walk
+	Range<T>    _range;
+	// The distance between visited elements
+	std::size_t _stride;
+	// The index of the first visited element
+	std::size_t _phase;
+
+public:
+
+	/*!
+	 * @brief Conversion constructor
+	 * @param range The range to walk
+	 * @param stride The distance between visited elements, at least 1
+	 * @param phase The index of the first visited element, taken modulo stride
+	 */
+	StridedRange(const Range<T> &range, std::size_t stride, std::size_t phase = 0)
+			: _range(range), _stride(stride < 1 ? 1 : stride), _phase(phase % _stride) {
+	}
+
+	/*!
+	 * @brief Calls a function on every stride-th element
+	 * @tparam F The function type (can be deduced)
+	 * @param function Called with a T & for every visited element
+	 * @return The function that was passed in
+	 */
+	template<typename F>
+	F ForEach(F function) const {
+
+		const std::size_t stride = _stride;
+		ForEachIndex(_range, _phase, [stride](std::size_t index) {
+			return index + stride;
+		}, function);
+		return function;
+	}
+
+	/*!
+	 * @brief Moves on to the next phase, for the next pass
+	 */
+	void Rotate() noexcept(true) {
+
+		_phase = (_phase + 1) % _stride;
+	}
+
+	/*!
+	 * @brief Gets the distance between visited elements
+	 * @return The stride
+	 */
+	std::size_t Stride() const noexcept(true) {
+
+		return _stride;
+	}
+
+	/*!
+	 * @brief Gets the index of the first visited element
+	 * @return The phase
+	 */
+	std::size_t Phase() const noexcept(true) {
+
+		return _phase;
+	}
+};
+
+/*!
+ * @brief Visits a uniform random sample of a range's elements, without repeats
+ * @details
+ *      The indices are drawn with Floyd's algorithm into a bitmap, which takes
+ *      one random number per sampled element, and visited in container order
+ *      with ForEachIndex. Random access containers know their length. Other
+ *      containers are given it, such as the container's size(), or count it
+ *      with one walk on the first pass and keep it, so call SetLength when
+ *      they grow or shrink. The bitmap is kept between passes.
+ * @tparam T The base type
+ */
+template<typename T>
+class SampledRange
+{
+	// The range to sample
+	Range<T>                   _range;
+	// The number of elements to visit
+	std::size_t                _size;
+	// The number of elements in a range that is not random access, or ITERATOR_STRIDE_NONE to count them
+	std::size_t                _length;
+	// One bit per element, set for the chosen ones
+	std::vector<std::uint64_t> _chosen;
+	// The chosen indices in order
+	std::vector<std::size_t>   _indices;
+
+	/*!
+	 * @brief Marks an index as chosen
+	 * @param index The index
+	 * @return True if it was not already chosen
+	 */
+	bool Choose(std::size_t index) noexcept(true) {
+
+		std::uint64_t &word = _chosen[index / 64];
+		const std::uint64_t bit = std::uint64_t(1) << (index % 64);
+		const bool fresh = !(word & bit);
+		word |= bit;
+		return fresh;
+	}
+
+	/*!
+	 * @brief Chooses the indices to visit
+	 * @param length The number of elements in the range
+	 * @param engine The random number engine
+	 */
+	template<typename URBG>
+	void Draw(std::size_t length, URBG &engine) {
+
+		_chosen.assign((length + 63) / 64, 0);
+		for (std::size_t last = length - _size; last < length; ++last) {
+			if (!Choose(std::uniform_int_distribution<std::size_t>(0, last)(engine))) {
+				Choose(last);
+			}
+		}
+		_indices.clear();
+		for (std::size_t i = 0; i < _chosen.size(); ++i) {
+			for (std::uint64_t word = _chosen[i]; word; word &= word - 1) {
+				_indices.push_back(i * 64 + LowestBit(word));
+			}
+		}
+	}
+
+	/*!
+	 * @brief Gets the number of elements in the range
+	 * @return The length, counted once and kept for ranges that are not random access
+	 */
+	std::size_t Length() {
+
+		const Iterator<T> first = _range.begin();
+		if (first.RandomAccess()) {
+			return static_cast<std::size_t>(first - _range.end());
+		}
+		if (_length == ITERATOR_STRIDE_NONE) {
+			_length = static_cast<std::size_t>(first - _range.end());
+		}
+		return _length;
+	}
+
+public:
+
+	/*!
+	 * @brief Conversion constructor
+	 * @param range The range to sample
+	 * @param size The number of elements to visit in each pass
+	 * @param length The number of elements in the range, such as the container's
+	 * size(), or ITERATOR_STRIDE_NONE to count them on the first pass
+	 */
+	SampledRange(const Range<T> &range, std::size_t size, std::size_t length = ITERATOR_STRIDE_NONE)
+			: _range(range), _size(size), _length(length) {
+	}
+
+	/*!
+	 * @brief Calls a function on a new random sample of the elements, in container order
+	 * @tparam F The function type (can be deduced)
+	 * @tparam URBG The random number engine type (can be deduced)
+	 * @param function Called with a T & for every sampled element
+	 * @param engine The random number engine, such as std::mt19937
+	 * @return The function that was passed in
+	 */
+	template<typename F, typename URBG>
+	F ForEach(F function, URBG &engine) {
+
+		const std::size_t length = Length();
+		if (_size >= length) {
+			return ::ForEach(_range, std::move(function));
+		}
+		if (_size == 0) {
+			return function;
+		}
+		Draw(length, engine);
+		const std::size_t *position = _indices.data();
+		const std::size_t *last = position + _indices.size();
+		ForEachIndex(_range, *position, [&position, last](std::size_t) {
+			return ++position == last ? ITERATOR_STRIDE_NONE : *position;
+		}, function);
+		return function;
+	}
+
+	/*!
+	 * @brief Gets the number of elements visited in each pass
+	 * @return The sample size, or the size of the range if it is smaller
+	 */
+	std::size_t Size() const noexcept(true) {
+
+		return _size;
+	}
+
+	/*!
+	 * @brief Tells the range how many elements it has, after the container grew or shrank
+	 * @details
+	 *      Random access ranges always measure themselves and ignore this
+	 * @param length The number of elements, such as the container's size(), or
+	 * ITERATOR_STRIDE_NONE to count them again on the next pass
+	 */
+	void SetLength(std::size_t length) noexcept(true) {
+
+		_length = length;
+	}
+};
+
+/*!
+ * @brief Creates a range that visits every stride-th element
+ * @tparam T The base type (can be deduced)
+ * @param range The range to walk
+ * @param stride The distance between visited elements
+ * @param phase The index of the first visited element
+ * @return A StridedRange over range
+ */
+template<typename T>
+StridedRange<T> MakeStridedRange(const Range<T> &range, std::size_t stride, std::size_t phase = 0) {
+
+	return StridedRange<T>(range, stride, phase);
+}
+
+/*!
+ * @brief Creates a range that visits a random sample of the elements
+ * @tparam T The base type (can be deduced)
+ * @param range The range to sample
+ * @param size The number of elements to visit in each pass
+ * @param length The number of elements in the range, such as the container's
+ * size(), or ITERATOR_STRIDE_NONE to count them on the first pass
+ * @return A SampledRange over range
+ */
+template<typename T>
+SampledRange<T> MakeSampledRange(const Range<T> &range, std::size_t size,
+                                 std::size_t length = ITERATOR_STRIDE_NONE) {
+
+	return SampledRange<T>(range, size, length);
+}
+
+#endif //TEMPL_ITERATOR_ITERATOR_STRIDE_H
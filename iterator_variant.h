@@ -0,0 +1,249 @@
+/*!
+ * @file iterator_variant.h
+ * @author Saadiq Daniels
+ * @date 18/10/2026
+ * @version 1.0
+ * @brief
+ * 	An iterator over one of a fixed list of container iterator types, held
+ * 	in a std::variant, for builds that know every container up front
+ */
+
+#ifndef TEMPL_ITERATOR_ITERATOR_VARIANT_H
+#define TEMPL_ITERATOR_ITERATOR_VARIANT_H
+
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#include "iterator.h"
+
+/*!
+ * @brief Walks a container through one of a fixed list of iterator types
+ * @details
+ *      The container's iterator is stored inside the object, so there is no
+ *      heap copy, reference count or vtable. Every operation picks the
+ *      iterator type with std::visit, and ForEach picks it once for the
+ *      whole walk. An Iterator<T> can be turned into a VariantIterator with
+ *      From when it hides one of the listed types, and a VariantIterator can
+ *      always be turned back into an Iterator<T>. As with Iterator<T>::Native,
+ *      the constness of the elements must match T: list const_iterators for
+ *      a const T and iterators for a non-const T.
+ * @tparam T The base class type
+ * @tparam U The container iterator types
+ */
+template<typename T, typename... U>
+class VariantIterator
+{
+	static_assert(sizeof...(U) > 0, "VariantIterator needs at least one iterator type");
+	static_assert((std::is_convertible<std::remove_reference_t<decltype(*std::declval<U &>())> *, T *>::value && ...),
+	              "Every iterator type must walk objects that are T, with const elements only for a const T");
+	static_assert(!std::is_const<T>::value ||
+	              (std::is_const<std::remove_reference_t<decltype(*std::declval<U &>())>>::value && ...),
+	              "Every iterator type must walk const elements for a const T");
+
+public:
+	// User friendly names for data types
+	using iterator_category = std::forward_iterator_tag;
+	using value_type = T;
+	using difference_type = long;
+	using pointer = T *;
+	using reference = T &;
+
+private:
+	// The container's iterator
+	std::variant<U...> _it;
+
+	/*!
+	 * @brief Finds the first listed type that an Iterator<T> hides
+	 * @tparam V The type to try
+	 * @tparam Rest The types to try after it
+	 * @param rhs The iterator to look inside
+	 * @return The variant iterator, or nothing if rhs hides none of the types
+	 */
+	template<typename V, typename... Rest>
+	static std::optional<VariantIterator> Unwrap(const Iterator<T> &rhs) noexcept(true) {
+
+		if (const V *native = rhs.template Native<V>()) {
+			return VariantIterator(*native);
+		}
+		if constexpr(sizeof...(Rest) > 0) {
+			return Unwrap<Rest...>(rhs);
+		} else {
+			return std::nullopt;
+		}
+	}
+
+public:
+
+	/*!
+	 * @brief Checks if an Iterator<T> hides one of the listed types
+	 * @param rhs The iterator to look inside
+	 * @return True if rhs can be turned into a VariantIterator
+	 */
+	static bool Holds(const Iterator<T> &rhs) noexcept(true) {
+
+		return ((rhs.template Native<U>() != nullptr) || ...);
+	}
+
+	/*!
+	 * @brief Default constructor, holds a default constructed iterator of the first type
+	 */
+	VariantIterator() noexcept(true) = default;
+
+	/*!
+	 * @brief Conversion constructor, taking a container iterator
+	 * @tparam V The container iterator type, which must be one of U (can be deduced)
+	 * @param iterator The iterator to store
+	 */
+	template<typename V, typename = std::enable_if_t<(std::is_same<std::decay_t<V>, U>::value || ...)>>
+	explicit VariantIterator(V &&iterator) noexcept(true) : _it(std::forward<V>(iterator)) {
+	}
+
+	/*!
+	 * @brief Takes the container iterator out of an Iterator<T>
+	 * @param rhs The iterator to look inside
+	 * @return The variant iterator, or nothing if rhs hides none of the listed types
+	 */
+	static std::optional<VariantIterator> From(const Iterator<T> &rhs) noexcept(true) {
+
+		return Unwrap<U...>(rhs);
+	}
+
+	/*!
+	 * @brief Gets the container iterator, if it is a V
+	 * @tparam V The container iterator type to look for
+	 * @return A pointer to the stored iterator, or nullptr if it is another type
+	 */
+	template<typename V>
+	const V *Native() const noexcept(true) {
+
+		return std::get_if<V>(&_it);
+	}
+
+	/*!
+	 * @brief Converts back to a type erased iterator
+	 * @return An Iterator<T> holding a copy of the container iterator
+	 */
+	explicit operator Iterator<T>() const {
+
+		return std::visit([](const auto &it) {
+			return MakeIterator<T>(it);
+		}, _it);
+	}
+
+	/*!
+	 * @brief Dereference operator
+	 * @return A reference to the current element
+	 */
+	reference operator*() const noexcept(true) {
+
+		return *operator->();
+	}
+
+	/*!
+	 * @brief Arrow operator
+	 * @return A pointer to the current element
+	 */
+	pointer operator->() const noexcept(true) {
+
+		return std::visit([](const auto &it) -> pointer {
+			return &*it;
+		}, _it);
+	}
+
+	/*!
+	 * @brief Increment operator
+	 * @return A reference to this iterator
+	 */
+	VariantIterator &operator++() noexcept(true) {
+
+		std::visit([](auto &it) {
+			++it;
+		}, _it);
+		return *this;
+	}
+
+	/*!
+	 * @brief Equality operator
+	 * @param rhs The iterator to compare with
+	 * @return True if both hold the same type of iterator and point at the same element
+	 */
+	bool operator==(const VariantIterator &rhs) const noexcept(true) {
+
+		return _it == rhs._it;
+	}
+
+	/*!
+	 * @brief Inequality operator
+	 * @param rhs The iterator to compare with
+	 * @return False if both hold the same type of iterator and point at the same element
+	 */
+	bool operator!=(const VariantIterator &rhs) const noexcept(true) {
+
+		return !(*this == rhs);
+	}
+
+	/*!
+	 * @brief Calls a function on every element from here to last, picking the
+	 * iterator type once and looping over the container's own iterator
+	 * @tparam F The function type (can be deduced)
+	 * @param last The iterator to stop at, which must hold the same type
+	 * @param function Called with a T & for every element
+	 * @return False if last holds another type of iterator, nothing is visited then
+	 */
+	template<typename F>
+	bool Walk(const VariantIterator &last, F &function) const {
+
+		return std::visit([&last, &function](const auto &first) {
+			using V = std::decay_t<decltype(first)>;
+			const V *stop = std::get_if<V>(&last._it);
+			if (!stop) {
+				return false;
+			}
+			for (V it = first; it != *stop; ++it) {
+				function(static_cast<reference>(*it));
+			}
+			return true;
+		}, _it);
+	}
+};
+
+/*!
+ * @brief Calls a function on every element between two variant iterators
+ * @details
+ *      std::visit runs once for the whole walk, and the loop inside it uses
+ *      the container's own iterator
+ * @tparam T The base type
+ * @tparam U The container iterator types
+ * @tparam F The function type (can be deduced)
+ * @param begin The first element to visit
+ * @param end The iterator to stop at, holding the same type as begin, or
+ * nothing is visited
+ * @param function Called with a T & for every element
+ * @return The function, after it has visited every element
+ */
+template<typename T, typename... U, typename F>
+F ForEach(const VariantIterator<T, U...> &begin, const VariantIterator<T, U...> &end, F function) {
+
+	begin.Walk(end, function);
+	return function;
+}
+
+/*!
+ * @brief Creates a pair of variant iterators that cover a container
+ * @tparam T The base type (must be specified)
+ * @tparam U The container iterator types (must be specified)
+ * @tparam C The container type (can be deduced)
+ * @param container The container to cover
+ * @return The begin and end iterators
+ */
+template<typename T, typename... U, typename C>
+std::pair<VariantIterator<T, U...>, VariantIterator<T, U...>> MakeVariantRange(C &container) {
+
+	return {VariantIterator<T, U...>(container.begin()), VariantIterator<T, U...>(container.end())};
+}
+
+#endif //TEMPL_ITERATOR_ITERATOR_VARIANT_H
@@ -7,6 +7,9 @@
  * 	The declaration of the iterator wrapper class, which extends from
  * 	the base iterator class
  */
+#include <iterator>
+#include <type_traits>
+#include <typeinfo>
 #include <utility>
 #include "iterator_base.h"
 
@@ -36,7 +39,14 @@ public:
     using mutable_derived_type = typename make_mutable<derived_type>::type;
     using const_derived_type = typename make_const<derived_type>::type;
     //Figuring out if *operator returns a pair or not
-    using return_value = typename std::result_of<decltype(&derived_type::operator*)(derived_type)>::type;
+    using return_value = decltype(*std::declval<mutable_derived_type &>());
+    // True if *operator returns something that is already a base class object,
+    // false for pairs and pointers, which are handled by the derived wrappers
+    static constexpr bool is_direct = std::is_convertible<std::remove_reference_t<return_value> *, pointer>::value;
+    // True if *operator returns a pointer or smart pointer to a base class object,
+    // which iterator_wrapper_indirect looks through
+    static constexpr bool is_indirect = !is_direct &&
+            is_pointer_to<std::remove_cv_t<std::remove_reference_t<return_value>>, T>::value;
 
     friend class IteratorWrapper<mutable_value_type, mutable_derived_type>;
 
@@ -142,11 +152,14 @@ public:
      */
     virtual reference operator*() const noexcept(true) {
 
-        if constexpr(!is_pair<return_value>::value) {
+        if constexpr(is_direct) {
             return *_it;
+        } else if constexpr(is_indirect) {
+            return *Pointee(*_it);
         } else {
             // This code will not be called
-            // it will be overloaded by iterator_wrapper_left and iterator_wrapper_right
+            // it will be overloaded by iterator_wrapper_left, iterator_wrapper_right
+            // and iterator_wrapper_indirect
             return reinterpret_cast<reference>(*_it);
         }
     }
@@ -157,11 +170,14 @@ public:
      */
     virtual pointer operator->() const noexcept(true) {
 
-        if constexpr(!is_pair<return_value>::value) {
+        if constexpr(is_direct) {
             return &*_it;
+        } else if constexpr(is_indirect) {
+            return Pointee(*_it);
         } else {
             // This code will not be called
-            // it will be overloaded by iterator_wrapper_left and iterator_wrapper_right
+            // it will be overloaded by iterator_wrapper_left, iterator_wrapper_right
+            // and iterator_wrapper_indirect
             return reinterpret_cast<pointer>(&*_it);
         }
     }
@@ -176,6 +192,129 @@ public:
         return static_cast<Iterator<T> &>(*this);
     }
 
+    /*!
+     * @brief Moves the iterator forward by more than one element
+     * @param count The number of elements to move forward
+     * @return A reference to the left hand object
+     */
+    virtual Iterator<T> &Advance(difference_type count) noexcept(true) {
+
+        std::advance(_it, count);
+        return static_cast<Iterator<T> &>(*this);
+    }
+
+    /*!
+     * @brief Checks if the derived iterator is random access
+     * @return True if Advance and operator- take constant time
+     */
+    virtual bool RandomAccess() const noexcept(true) {
+
+        return std::is_base_of<std::random_access_iterator_tag,
+                typename std::iterator_traits<mutable_derived_type>::iterator_category>::value;
+    }
+
+    /*!
+     * @brief Counts the entries this iterator stepped over when it was made
+     * @return 0, only iterators that skip entries step over any
+     */
+    virtual typename Iterator<T>::difference_type Skipped() const noexcept(true) {
+
+        return 0;
+    }
+
+    /*!
+     * @brief Batched increment, writes the addresses of up to count elements
+     * into out and moves this iterator past them
+     * @param out The array to write the element addresses into
+     * @param count The size of the out array
+     * @param end The iterator to stop at
+     * @return The number of addresses written
+     */
+    virtual std::size_t Batch(pointer *out, std::size_t count, const Iterator<T> &end) noexcept(true) {
+
+        return BatchOf(out, count, end, &IteratorWrapper<T, U>::Address);
+    }
+
+    /*!
+     * @brief Walks from this iterator to end with a copy of the derived iterator
+     * @param end The iterator to stop at
+     * @param visit Called with each element and its distance from this iterator,
+     * the walk stops when it returns false
+     * @return The distance to the element the walk stopped at, or to end
+     */
+    virtual std::size_t Scan(const Iterator<T> &end, FunctionRef<bool(T &, std::size_t)> visit) const {
+
+        return ScanOf(end, visit, &IteratorWrapper<T, U>::Address);
+    }
+
+    /*!
+     * @brief Segmented increment, writes up to count runs of evenly spaced
+     * elements into out and moves this iterator past them
+     * @details
+     *      Pointers and std::vector iterators hand out everything up to end as
+     *      one run, std::deque iterators one run per block. Any other iterator
+     *      is walked with Batch, one run per element.
+     * @param out The array to write the runs into
+     * @param count The size of the out array
+     * @param end The iterator to stop at
+     * @return The number of runs written
+     */
+    virtual std::size_t Segments(Span<T> *out, std::size_t count, const Iterator<T> &end) noexcept(true) {
+
+        if constexpr(is_direct && is_contiguous_iterator<mutable_derived_type>::value) {
+            const mutable_derived_type &last = reinterpret_cast<const IteratorWrapper<T, U> &>(end)._it;
+            if (count == 0 || _it == last) {
+                return 0;
+            }
+            out[0] = Span<T>{Address(_it), static_cast<std::size_t>(std::distance(_it, last)),
+                             sizeof(std::remove_reference_t<return_value>), ExactType()};
+            _it = last;
+            return 1;
+        } else if constexpr(is_direct && is_block_iterator<mutable_derived_type>::value) {
+            // Find the block boundaries by checking whether the element k
+            // places on is k places on in memory. Two blocks can sit next to
+            // each other in memory, so a run is never longer than a block:
+            // within that only the next block can be reached, and a match
+            // there means the elements in between are in place too.
+            using element_type = std::remove_reference_t<return_value>;
+            using difference_type = typename std::iterator_traits<mutable_derived_type>::difference_type;
+            const mutable_derived_type &last = reinterpret_cast<const IteratorWrapper<T, U> &>(end)._it;
+            const std::type_info *type = ExactType();
+            std::size_t written = 0;
+            for (; written < count && _it != last; ++written) {
+                element_type *first = &*_it;
+                const auto inRun = [this, first](std::size_t offset) {
+                    return &*(_it + static_cast<difference_type>(offset)) == first + offset;
+                };
+                const auto left = static_cast<std::size_t>(last - _it);
+                const std::size_t block = deque_block_size<std::remove_cv_t<element_type>>::value;
+                const std::size_t remaining = left < block ? left : block;
+                // Gallop to an offset past the end of the block, then binary
+                // search back for the end, so each block costs O(log size)
+                std::size_t inside = 0;
+                std::size_t step = 1;
+                while (inside + step < remaining && inRun(inside + step)) {
+                    inside += step;
+                    step *= 2;
+                }
+                std::size_t outside = inside + step < remaining ? inside + step : remaining;
+                while (outside - inside > 1) {
+                    const std::size_t middle = inside + (outside - inside) / 2;
+                    if (inRun(middle)) {
+                        inside = middle;
+                    } else {
+                        outside = middle;
+                    }
+                }
+                out[written] = Span<T>{first, inside + 1, sizeof(element_type), type};
+                _it += static_cast<difference_type>(inside + 1);
+            }
+            return written;
+        } else {
+            return SegmentsOf(out, count, end);
+        }
+    }
+
     /*!
      * @brief Copies this iterator
      * @return A new, identical iterator
@@ -184,6 +323,134 @@ public:
 
         return new IteratorWrapper<T, U>(_it);
     }
+
+protected:
+
+    /*!
+     * @brief Finds the base class object that a derived iterator points at
+     * @param iterator The derived iterator to look through
+     * @return A pointer to the base class object
+     */
+    static pointer Address(const mutable_derived_type &iterator) noexcept(true) {
+
+        if constexpr(is_direct) {
+            return &*iterator;
+        } else if constexpr(is_indirect) {
+            return Pointee(*iterator);
+        } else {
+            // This code will not be called
+            // it will be overloaded by iterator_wrapper_left, iterator_wrapper_right
+            // and iterator_wrapper_indirect
+            return reinterpret_cast<pointer>(&*iterator);
+        }
+    }
+
+    /*!
+     * @brief Gets a raw pointer out of a pointer-like container element
+     * @tparam P The pointer or smart pointer type (can be deduced)
+     * @param element The pointer or smart pointer stored in the container
+     * @return The raw pointer, which can be null
+     */
+    template<typename P>
+    static pointer Pointee(const P &element) noexcept(true) {
+
+        if constexpr(std::is_pointer<P>::value) {
+            return element;
+        } else {
+            return element.get();
+        }
+    }
+
+    /*!
+     * @brief Finds the hidden container's iterator
+     * @param type The type of container iterator to look for
+     * @return The address of _it, or nullptr if it is another type
+     */
+    virtual const void *NativeAddress(const std::type_info &type) const noexcept(true) {
+
+        return type == typeid(mutable_derived_type) ? &_it : nullptr;
+    }
+
+    /*!
+     * @brief Finds the exact type of the objects the base class references point at
+     * @return The type, or nullptr if it is not known
+     */
+    virtual const std::type_info *ExactType() const noexcept(true) {
+
+        using element_type = std::remove_cv_t<std::remove_reference_t<return_value>>;
+        // Only trusted when the iterator says it walks over objects of that type
+        if constexpr(is_direct && std::is_same<element_type,
+                typename std::iterator_traits<mutable_derived_type>::value_type>::value) {
+            return &typeid(element_type);
+        } else {
+            return nullptr;
+        }
+    }
+
+    /*!
+     * @brief Builds one run per element out of a call to Batch, for iterators
+     * that cannot say where their elements are stored
+     * @param out The array to write the runs into
+     * @param count The size of the out array
+     * @param end The iterator to stop at
+     * @return The number of runs written
+     */
+    std::size_t SegmentsOf(Span<T> *out, std::size_t count, const Iterator<T> &end) noexcept(true) {
+
+        pointer batch[ITERATOR_BATCH_SIZE];
+        const std::size_t written = this->Batch(batch, count < ITERATOR_BATCH_SIZE ? count : ITERATOR_BATCH_SIZE, end);
+        const std::type_info *type = ExactType();
+        for (std::size_t i = 0; i < written; ++i) {
+            out[i] = Span<T>{batch[i], 1, 0, type};
+        }
+        return written;
+    }
+
+    /*!
+     * @brief The loop behind Scan, shared with the specializations so that
+     * they only need to say how to find the base class object
+     * @tparam F The type of the address function
+     * @param end The iterator to stop at
+     * @param visit Called with each element and its distance from this iterator
+     * @param address Takes a derived iterator and returns a pointer to the base class
+     * object, or nullptr to pass over the element
+     * @return The distance to the element the walk stopped at, or to end
+     */
+    template<typename F>
+    std::size_t ScanOf(const Iterator<T> &end, FunctionRef<bool(T &, std::size_t)> visit, F address) const {
+
+        const mutable_derived_type &last = reinterpret_cast<const IteratorWrapper<T, U> &>(end)._it;
+        mutable_derived_type it(_it);
+        std::size_t distance = 0;
+        for (; it != last; ++it, ++distance) {
+            pointer element = address(it);
+            if (element && !visit(*element, distance)) {
+                break;
+            }
+        }
+        return distance;
+    }
+
+    /*!
+     * @brief The loop behind Batch, shared with the specializations so that
+     * they only need to say how to find the base class object
+     * @tparam F The type of the address function
+     * @param out The array to write the element addresses into
+     * @param count The size of the out array
+     * @param end The iterator to stop at
+     * @param address Takes a derived iterator and returns a pointer to the base class object
+     * @return The number of addresses written
+     */
+    template<typename F>
+    std::size_t BatchOf(pointer *out, std::size_t count, const Iterator<T> &end, F address) noexcept(true) {
+
+        const mutable_derived_type &last = reinterpret_cast<const IteratorWrapper<T, U> &>(end)._it;
+        std::size_t written = 0;
+        for (; written < count && _it != last; ++written, ++_it) {
+            out[written] = address(_it);
+        }
+        return written;
+    }
 };
 
 #endif //TEMPL_ITERATOR_ITERATOR_WRAPPER_H
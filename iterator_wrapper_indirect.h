@@ -0,0 +1,153 @@
+/*!
+ * @file iterator_wrapper_indirect.h
+ * @author Saadiq Daniels
+ * @date 18/10/2026
+ * @version 1.0
+ * @brief
+ * 	The further specialization for containers of pointers, such as
+ * 	std::vector< derived * > or std::vector< std::unique_ptr< derived > >,
+ * 	which dereferences through the stored pointer
+ */
+
+#ifndef TEMPL_ITERATOR_ITERATOR_WRAPPER_INDIRECT_H
+#define TEMPL_ITERATOR_ITERATOR_WRAPPER_INDIRECT_H
+
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "iterator_wrapper.h"
+
+template<typename T, typename U>
+class IteratorWrapperIndirect : public IteratorWrapper<T, U>
+{
+	typedef typename make_const<U>::type                                   CU;
+	typedef typename make_mutable<U>::type                                 MU;
+	using IteratorWrapper<T, U>::Pointee;
+
+	// Where to stop when skipping null entries
+	MU   _last;
+	// True if null entries should be skipped
+	bool _skip;
+	// The number of null entries skipped when this iterator was made
+	typename Iterator<T>::difference_type _skipped;
+
+	/*!
+	 * @brief Moves the iterator forward past any null entries
+	 */
+	void SkipNull() noexcept(true) {
+
+		while (_skip && IteratorWrapper<T, U>::_it != _last && !Pointee(*IteratorWrapper<T, U>::_it)) {
+			++IteratorWrapper<T, U>::_it;
+		}
+	}
+
+public:
+
+	/*!
+	 * @brief Conversion constructor, takes an iterator
+	 * @param iterator The iterator to store internally
+	 */
+	explicit IteratorWrapperIndirect(CU &iterator) noexcept(true)
+			: IteratorWrapper<T, U>(iterator), _last(iterator), _skip(false), _skipped(0) {
+	}
+
+	/*!
+	 * @brief Conversion constructor, takes an iterator and the end of its container,
+	 * null entries between the two are skipped
+	 * @param iterator The iterator to store internally
+	 * @param last The end of the container
+	 */
+	IteratorWrapperIndirect(CU &iterator, CU &last) noexcept(true)
+			: IteratorWrapper<T, U>(iterator), _last(last), _skip(true), _skipped(0) {
+
+		SkipNull();
+		_skipped = std::distance(MU(iterator), IteratorWrapper<T, U>::_it);
+	}
+
+	/*!
+	 * @brief Copy constructor for Copy, keeps the number of skipped entries
+	 * @param rhs The iterator to copy
+	 */
+	IteratorWrapperIndirect(const IteratorWrapperIndirect &rhs) noexcept(true)
+			: IteratorWrapper<T, U>(rhs._it), _last(rhs._last), _skip(rhs._skip), _skipped(rhs._skipped) {
+	}
+
+	/*!
+	 * @brief Default destructor
+	 */
+	virtual ~IteratorWrapperIndirect() noexcept(true) = default;
+
+	/*!
+	 * @brief Increment operator, skips null entries if asked to
+	 * @return A reference to the left hand object
+	 */
+	virtual Iterator<T> &operator++() noexcept(true) {
+
+		++IteratorWrapper<T, U>::_it;
+		SkipNull();
+		return static_cast<Iterator<T> &>(*this);
+	}
+
+	/*!
+	 * @brief Moves the iterator forward by count container entries, then past any null entries
+	 * if asked to skip them
+	 * @param count The number of entries to move forward
+	 * @return A reference to the left hand object
+	 */
+	virtual Iterator<T> &Advance(typename Iterator<T>::difference_type count) noexcept(true) {
+
+		std::advance(IteratorWrapper<T, U>::_it, count);
+		SkipNull();
+		return static_cast<Iterator<T> &>(*this);
+	}
+
+	/*!
+	 * @brief Counts the null entries this iterator stepped over when it was made
+	 * @return The number of leading null entries, 0 if it does not skip them
+	 */
+	virtual typename Iterator<T>::difference_type Skipped() const noexcept(true) {
+
+		return _skipped;
+	}
+
+	/*!
+	 * @brief Batched increment, writes the stored pointers of up to count elements
+	 * into out and moves this iterator past them
+	 * @details
+	 *      Every object is prefetched as its pointer is written, so the caller's
+	 *      loop over the batch does not wait on a cache miss for each one.
+	 *      Null entries are always dropped, without a branch, so ForEach never
+	 *      sees one, even on an iterator that was made without an end to skip to.
+	 * @param out The array to write the element addresses into
+	 * @param count The size of the out array
+	 * @param end The iterator to stop at
+	 * @return The number of addresses written
+	 */
+	virtual std::size_t Batch(T **out, std::size_t count, const Iterator<T> &end) noexcept(true) {
+
+		MU       &it   = IteratorWrapper<T, U>::_it;
+		const MU &last = reinterpret_cast<const IteratorWrapperIndirect<T, U> &>(end)._it;
+		std::size_t written = 0;
+		for (; written < count && it != last; ++it) {
+			T *element = Pointee(*it);
+			ITERATOR_PREFETCH(element);
+			out[written] = element;
+			written += element != nullptr;
+		}
+		// Leave the iterator on an element, like operator++ does
+		SkipNull();
+		return written;
+	}
+
+	/*!
+	 * @brief Copies this iterator
+	 * @return A new, identical iterator
+	 */
+	virtual Iterator<T> *Copy() const noexcept(true) {
+
+		return new IteratorWrapperIndirect(*this);
+	}
+};
+
+#endif //TEMPL_ITERATOR_ITERATOR_WRAPPER_INDIRECT_H
@@ -63,6 +63,35 @@ public:
 		return &((*IteratorWrapper<T, U>::_it).second);
 	}
 
+	/*!
+	 * @brief Batched increment, writes the addresses of up to count elements
+	 * into out and moves this iterator past them
+	 * @param out The array to write the element addresses into
+	 * @param count The size of the out array
+	 * @param end The iterator to stop at
+	 * @return The number of addresses written
+	 */
+	virtual std::size_t Batch(T **out, std::size_t count, const Iterator<T> &end) noexcept(true) {
+
+		return IteratorWrapper<T, U>::BatchOf(out, count, end, [](const U &iterator) {
+			return &((*iterator).second);
+		});
+	}
+
+	/*!
+	 * @brief Walks from this iterator to end with a copy of the derived iterator
+	 * @param end The iterator to stop at
+	 * @param visit Called with each element and its distance from this iterator,
+	 * the walk stops when it returns false
+	 * @return The distance to the element the walk stopped at, or to end
+	 */
+	virtual std::size_t Scan(const Iterator<T> &end, FunctionRef<bool(T &, std::size_t)> visit) const {
+
+		return IteratorWrapper<T, U>::ScanOf(end, visit, [](const U &iterator) {
+			return &((*iterator).second);
+		});
+	}
+
 	/*!
 	 * @brief Copies this iterator
 	 * @return A new, identical iterator
@@ -71,6 +100,17 @@ public:
 
 		return new IteratorWrapperRight(IteratorWrapper<T, U>::_it);
 	}
+
+protected:
+
+	/*!
+	 * @brief Finds the exact type of the objects the base class references point at
+	 * @return The type of the value member of the pairs
+	 */
+	virtual const std::type_info *ExactType() const noexcept(true) {
+
+		return &typeid(std::remove_cv_t<decltype(std::declval<U &>()->second)>);
+	}
 };
 
 #endif //TEMPL_ITERATOR_ITERATOR_WRAPPER_RIGHT_H
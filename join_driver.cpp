@@ -0,0 +1,160 @@
+/*!
+ * @file join_driver.cpp
+ * @author Saadiq Daniels
+ * @date 18/10/2026
+ * @version 1.0
+ */
+
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <string>
+#include <unordered_map>
+
+#include "iterator.h"
+#include "iterator_keyed.h"
+#include "iterator_join.h"
+#include "base.h"
+#include "benchmark.h"
+
+/*!
+ * The number of pairs found and the sum of their products
+ */
+struct Totals
+{
+	std::size_t pairs = 0;
+	double      sum = 0.0;
+
+	/*!
+	 * Adds a pair
+	 * @param lhs The left element
+	 * @param rhs The right element
+	 */
+	void operator()(const base &lhs, const base &rhs) {
+
+		++pairs;
+		sum += lhs.getfloat() * rhs.getfloat();
+	}
+
+	/*!
+	 * Equality operator
+	 * @param rhs The totals to compare with
+	 * @return True if both found the same pairs
+	 */
+	bool operator==(const Totals &rhs) const {
+
+		return pairs == rhs.pairs && sum == rhs.sum;
+	}
+};
+
+/*!
+ * Runs a join and the same join done with a Find per element, and reports both
+ * @param name The name of the containers
+ * @param physics The container that is walked by the per element version
+ * @param transforms The keyed range to join with
+ * @param joined The join
+ * @param count The number of elements walked
+ * @return True if both found the same pairs
+ */
+template<typename C, typename J>
+bool Compare(const std::string &name, C &physics, const KeyedRange<const base, int> &transforms, J &joined,
+             std::size_t count) {
+
+	Totals totals[2];
+	const Iterator<const base> end = transforms.end();
+	double time = Benchmark(3, [&]() {
+		totals[0] = Totals();
+		for (const auto &element : physics) {
+			const Iterator<const base> it = transforms.Find(static_cast<int>(element.first));
+			if (it != end) {
+				totals[0](element.second, *it);
+			}
+		}
+	});
+	Report(name + ", Find per element", time, count, count * sizeof(derived4));
+
+	time = Benchmark(3, [&]() {
+		totals[1] = joined.ForEach(Totals());
+	});
+	Report(name + (joined.Merges() ? ", merge join" : ", lookup join"), time, count, count * sizeof(derived4));
+
+	KeepAlive(totals[0].sum + totals[1].sum);
+	std::cout << "Pairs: " << totals[0].pairs << " " << totals[1].pairs << std::endl;
+	return totals[0] == totals[1];
+}
+
+/*!
+ * Tests joining physics components to transforms by id
+ * @return 0, or 1 if a join found different pairs than the per element lookups
+ */
+int main() {
+
+	// Creating data //
+
+	// Every physics id has a transform, half of the transform ids have physics
+	const int count = 1 << 19;
+	std::map<int, derived4> physics_map;
+	std::unordered_map<int, derived4> physics_hash;
+	std::map<int, derived4> transform_map;
+	std::unordered_map<int, derived4> transform_hash;
+	for (int i = 0; i < count * 2; ++i) {
+		const float number = static_cast<float>(i % 100);
+		if (i % 2 == 0) {
+			physics_map.emplace(i, derived4(number));
+			physics_hash.emplace(i, derived4(number));
+		}
+		transform_map.emplace(i, derived4(number));
+		transform_hash.emplace(i, derived4(number));
+	}
+
+	// Joining //
+
+	bool same = true;
+	{
+		// Both sorted, merged without lookups
+		auto joined = MakeJoinedRange(MakeKeyedRangeRight<const base>(physics_map),
+		                              MakeKeyedRangeRight<const base>(transform_map));
+		same = Compare("map with map", physics_map, MakeKeyedRangeRight<const base>(transform_map), joined, count) &&
+		       same && joined.Merges();
+	}
+	{
+		// The smaller side is walked and looked up in the hash table
+		auto joined = MakeJoinedRange(MakeKeyedRangeRight<const base>(physics_map),
+		                              MakeKeyedRangeRight<const base>(transform_hash));
+		same = Compare("map with unordered_map", physics_map, MakeKeyedRangeRight<const base>(transform_hash),
+		               joined, count) && same && !joined.Merges();
+	}
+	{
+		auto joined = MakeJoinedRange(MakeKeyedRangeRight<const base>(physics_hash),
+		                              MakeKeyedRangeRight<const base>(transform_hash));
+		same = Compare("unordered_map with unordered_map", physics_hash,
+		               MakeKeyedRangeRight<const base>(transform_hash), joined, count) && same;
+	}
+
+	{
+		// Sorted the other way round, merged with the maps' own comparison
+		std::map<int, derived4, std::greater<int>> physics_descending(physics_map.begin(), physics_map.end());
+		std::map<int, derived4, std::greater<int>> transform_descending(transform_map.begin(), transform_map.end());
+		auto joined = MakeJoinedRange(MakeKeyedRangeRight<const base>(physics_descending),
+		                              MakeKeyedRangeRight<const base>(transform_descending));
+		same = Compare("descending map with descending map", physics_descending,
+		               MakeKeyedRangeRight<const base>(transform_descending), joined, count) && same &&
+		       joined.Merges();
+	}
+	{
+		// Sorted in opposite orders, so a merge would miss pairs
+		std::map<int, derived4, std::greater<int>> transform_descending(transform_map.begin(), transform_map.end());
+		auto joined = MakeJoinedRange(MakeKeyedRangeRight<const base>(physics_map),
+		                              MakeKeyedRangeRight<const base>(transform_descending));
+		same = Compare("map with descending map", physics_map, MakeKeyedRangeRight<const base>(transform_descending),
+		               joined, count) && same && !joined.Merges();
+	}
+
+	if (!same) {
+		std::cout << "Joins do not match" << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,159 @@
+/*!
+ * @file keyed_driver.cpp
+ * @author Saadiq Daniels
+ * @date 18/10/2026
+ * @version 1.0
+ */
+
+#include <functional>
+#include <iostream>
+#include <map>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "iterator.h"
+#include "iterator_keyed.h"
+#include "base.h"
+#include "benchmark.h"
+
+/*!
+ * Tests looking elements and ranges of elements up by key through type erased ranges
+ * @return 0
+ */
+int main() {
+
+	// Creating data //
+
+	const int count = 100000;
+	std::unordered_map<int, derived4> derived4_hash;
+	std::map<int, derived4> derived4_map;
+	// Keyed by the object's own id, like GrabFromID
+	for (int i = 0; i < count; ++i) {
+		derived4 hashed(static_cast<float>(i % 100));
+		derived4_hash.emplace(hashed.getInt(), hashed);
+		derived4 mapped(static_cast<float>(i % 100));
+		derived4_map.emplace(mapped.getInt(), mapped);
+	}
+
+	// Both containers look the same from here on, only the key type is known //
+	std::vector<KeyedRange<base, int>> containers;
+	containers.push_back(MakeKeyedRangeRight<base>(derived4_hash));
+	containers.push_back(MakeKeyedRangeRight<base>(derived4_map));
+
+	for (const KeyedRange<base, int> &container : containers) {
+		const int key = container.begin()->getInt();
+		Iterator<base> found = container.Find(key);
+		std::cout << "Key " << key << ": (" << found->getInt() << ", " << found->getfloat() << ")\t"
+		          << "Key -1 found: " << container.Contains(-1) << std::endl;
+	}
+
+	// Benchmarking //
+
+	// Random keys, about half of which are in each container
+	const int lookups = 1000;
+	std::mt19937 random(42);
+	std::vector<int> keys(lookups);
+	for (int &key : keys) {
+		key = static_cast<int>(random() % (count * 2));
+	}
+	const char *names[] = {"unordered_map", "map"};
+	long hits[2][3] = {};
+
+	for (std::size_t c = 0; c < containers.size(); ++c) {
+		const KeyedRange<base, int> &container = containers[c];
+		// Without a key there is nothing to do but scan for the object
+		const Range<base> range = container.All();
+		double time = Benchmark(1, [&]() {
+			long found = 0;
+			for (int key : keys) {
+				found += any_of(range.begin(), range.end(), [key](const base &rhs) {
+					return rhs.getInt() == key;
+				});
+			}
+			hits[c][2] = found;
+		});
+		Report(std::string(names[c]) + " linear scan", time, lookups, 0);
+
+		time = Benchmark(3, [&]() {
+			long found = 0;
+			for (int key : keys) {
+				found += container.Contains(key);
+			}
+			hits[c][0] = found;
+		});
+		Report(std::string(names[c]) + " Find", time, lookups, 0);
+
+		// The same lookups straight on the container, for comparison
+		time = Benchmark(3, [&]() {
+			long found = 0;
+			for (int key : keys) {
+				found += c == 0 ? derived4_hash.count(key) : derived4_map.count(key);
+			}
+			hits[c][1] = found;
+		});
+		Report(std::string(names[c]) + " native count", time, lookups, 0);
+	}
+
+	if (hits[0][0] != hits[0][1] || hits[0][0] != hits[0][2] ||
+	    hits[1][0] != hits[1][1] || hits[1][0] != hits[1][2]) {
+		std::cout << "Lookups do not match" << std::endl;
+		return 1;
+	}
+
+	// Range queries, on the map and on a vector sorted by id //
+	std::vector<derived4> derived4_sorted;
+	derived4_sorted.reserve(count);
+	for (int i = 0; i < count; ++i) {
+		derived4_sorted.emplace_back(static_cast<float>(i % 100));
+	}
+	std::vector<KeyedRange<base, int>> ordered;
+	ordered.push_back(MakeKeyedRangeRight<base>(derived4_map));
+	ordered.push_back(MakeKeyedRangeSorted<base>(derived4_sorted, [](const derived4 &rhs) {
+		return rhs.getInt();
+	}));
+	const char *ordered_names[] = {"map", "sorted vector"};
+	long counts[2][2] = {};
+
+	for (std::size_t c = 0; c < ordered.size(); ++c) {
+		const KeyedRange<base, int> &container = ordered[c];
+		// About one percent of the keys
+		const int low = container.begin()->getInt() + count / 2;
+		const int high = low + count / 50;
+		const Range<base> range = container.All();
+		double time = Benchmark(3, [&]() {
+			counts[c][0] = count_if(range.begin(), range.end(), [low, high](const base &rhs) {
+				return rhs.getInt() >= low && rhs.getInt() < high;
+			});
+		});
+		Report(std::string(ordered_names[c]) + " [low, high) scan", time, static_cast<double>(count), 0);
+
+		time = Benchmark(3, [&]() {
+			const Range<base> between = container.Between(low, high);
+			counts[c][1] = between.begin() - between.end();
+		});
+		Report(std::string(ordered_names[c]) + " [low, high) Between", time, static_cast<double>(counts[c][1]), 0);
+	}
+	std::cout << "Elements in range: " << counts[0][1] << ", " << counts[1][1] << std::endl;
+
+	if (counts[0][0] != counts[0][1] || counts[1][0] != counts[1][1]) {
+		std::cout << "Range queries do not match" << std::endl;
+		return 1;
+	}
+
+	// A map sorted the other way round compares keys with its own key_comp //
+	std::map<int, derived4, std::greater<int>> derived4_descending;
+	for (int i = 0; i < 100; ++i) {
+		derived4_descending.emplace(i, derived4(static_cast<float>(i)));
+	}
+	const KeyedRange<base, int> descending = MakeKeyedRangeRight<base>(derived4_descending);
+	const Range<base> largest = descending.Between(60, 50);
+	const Range<base> backwards = descending.Between(50, 60);
+	if (largest.begin() - largest.end() != 10 || largest.begin()->getfloat() != 60.f ||
+	    backwards.begin() != backwards.end()) {
+		std::cout << "Descending range queries do not match" << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,107 @@
+/*!
+ * @file merge_driver.cpp
+ * @author Saadiq Daniels
+ * @date 18/10/2026
+ * @version 1.0
+ */
+
+#include <algorithm>
+#include <iostream>
+#include <map>
+#include <vector>
+
+#include "iterator.h"
+#include "iterator_merge.h"
+#include "base.h"
+#include "benchmark.h"
+
+/*!
+ * Tests walking several maps as one in key order
+ * @return 0, or 1 if the merge is out of order
+ */
+int main() {
+
+	// Creating data //
+
+	const int regions = 8;
+	const int count = 1 << 18;
+	// Components are handed out to regions unevenly, so every region's keys are interleaved
+	std::vector<std::map<derived4, int>> derived4_maps(regions);
+	std::vector<std::map<int, derived4>> derived4_ids(regions);
+	for (int i = 0; i < count; ++i) {
+		const int region = (i * 7 + i / 3) % regions;
+		derived4 component(static_cast<float>(i % 100));
+		derived4_maps[region].emplace(component, i);
+		derived4_ids[region].emplace(component.getInt(), component);
+	}
+
+	std::vector<Range<const base>> by_component;
+	std::vector<Range<const base>> by_id;
+	for (int region = 0; region < regions; ++region) {
+		by_component.push_back(MakeRangeLeft<const base>(derived4_maps[region]));
+		by_id.push_back(MakeRangeRight<const base>(derived4_ids[region]));
+	}
+	// The values of a map keyed by id are ordered by their id
+	const auto by_int = [](const base &lhs, const base &rhs) {
+		return lhs.getInt() < rhs.getInt();
+	};
+	MergedRange<const base> component_merge(by_component);
+	auto id_merge = MakeMergedRange(by_id, by_int);
+
+	// Benchmarking //
+
+	long checks[3] = {};
+	std::vector<const base *> sorted;
+
+	// Copying everything into a vector and sorting it, the way it used to be done
+	double time = Benchmark(5, [&]() {
+		sorted.clear();
+		for (const Range<const base> &range : by_component) {
+			ForEach(range, [&sorted](const base &rhs) {
+				sorted.push_back(&rhs);
+			});
+		}
+		std::sort(sorted.begin(), sorted.end(), [](const base *lhs, const base *rhs) {
+			return *lhs < *rhs;
+		});
+		long in_order = 0;
+		for (std::size_t i = 1; i < sorted.size(); ++i) {
+			in_order += !(*sorted[i] < *sorted[i - 1]);
+		}
+		checks[0] = in_order;
+	});
+	Report("copy and std::sort", time, count, count * sizeof(derived4));
+
+	time = Benchmark(5, [&]() {
+		component_merge.Reset();
+		long in_order = 0;
+		const base *previous = nullptr;
+		for (const base &rhs : component_merge) {
+			in_order += previous && !(rhs < *previous);
+			previous = &rhs;
+		}
+		checks[1] = in_order;
+	});
+	Report("MergedRange, MakeRangeLeft", time, count, count * sizeof(derived4));
+
+	time = Benchmark(5, [&]() {
+		id_merge.Reset();
+		long in_order = 0;
+		int previous = -1;
+		for (const base &rhs : id_merge) {
+			in_order += previous >= 0 && rhs.getInt() > previous;
+			previous = rhs.getInt();
+		}
+		checks[2] = in_order;
+	});
+	Report("MergedRange, MakeRangeRight", time, count, count * sizeof(derived4));
+
+	std::cout << "In order: " << checks[0] << ", " << checks[1] << ", " << checks[2] << " of " << count - 1
+	          << std::endl;
+	if (checks[0] != count - 1 || checks[1] != count - 1 || checks[2] != count - 1) {
+		std::cout << "Merge is out of order" << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,605 @@
+/*!
+ * @file paged_container.h
+ * @author Saadiq Daniels
+ * @date 18/10/2026
+ * @version 1.0
+ * @brief
+ * 	A read only container that streams its elements from a file a page at
+ * 	a time, keeping only a small window of pages in memory and reading the
+ * 	next pages ahead on a background thread
+ */
+
+#ifndef TEMPL_ITERATOR_PAGED_CONTAINER_H
+#define TEMPL_ITERATOR_PAGED_CONTAINER_H
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "iterator.h"
+
+/*!
+ * @brief Writes records to a file in the format PagedContainer reads
+ * @tparam Record A trivially copyable record type (can be deduced)
+ * @param path The file to write
+ * @param records The records to write
+ * @param count The number of records
+ * @return True if every record was written
+ */
+template<typename Record>
+bool WriteRecords(const std::string &path, const Record *records, std::size_t count) {
+
+	static_assert(std::is_trivially_copyable<Record>::value, "Records are written as raw bytes");
+	std::ofstream file(path, std::ios::binary | std::ios::trunc);
+	file.write(reinterpret_cast<const char *>(records), static_cast<std::streamsize>(count * sizeof(Record)));
+	return static_cast<bool>(file);
+}
+
+/*!
+ * @brief The counters kept by a PagedContainer
+ */
+struct PagedStats
+{
+	// Pages that were not in memory or on their way when they were needed
+	std::size_t faults = 0;
+	// Pages that were still being read ahead when they were needed
+	std::size_t stalls = 0;
+	// Pages read ahead that were ready by the time they were needed
+	std::size_t readAheadHits = 0;
+	// Pages read from the file, by either thread
+	std::size_t pagesRead = 0;
+	// Time spent waiting on faults and stalls, in seconds
+	double stallSeconds = 0.0;
+};
+
+template<typename Container>
+class PagedIterator;
+
+/*!
+ * @brief A container of Objects deserialised from a file of Records
+ * @details
+ *      The file is split into pages of a fixed number of records. At most
+ *      residentPages pages are in memory at once, in slots that are reused
+ *      as the window moves. Whenever a page is used, the next readAhead
+ *      pages are queued for a background thread to load.
+ *      A reference to an element stays good until its page leaves the
+ *      window. The window always has room for the page in use, the pages
+ *      being read ahead and one more, so smaller residentPages are raised
+ *      to readAhead + 2.
+ * @tparam Record A trivially copyable record type stored in the file
+ * @tparam Object The element type, constructed from a const Record &
+ */
+template<typename Record, typename Object>
+class PagedContainer
+{
+public:
+	// User friendly names for data types
+	using value_type = Object;
+	using size_type = std::size_t;
+	using iterator = PagedIterator<PagedContainer<Record, Object>>;
+
+private:
+	static_assert(std::is_trivially_copyable<Record>::value, "Records are read as raw bytes");
+
+	// The state of a page slot
+	enum class State
+	{
+		Empty,
+		Loading,
+		Ready,
+	};
+
+	// One page worth of memory, reused for whichever page it holds
+	struct Slot
+	{
+		std::vector<Object> objects;
+		std::size_t         page = 0;
+		State               state = State::Empty;
+		// True until a read ahead page is first used
+		bool                readAhead = false;
+		// When the page was last used, the smallest is evicted first
+		std::size_t         lastUsed = 0;
+	};
+
+	std::string _path;
+	size_type   _size;
+	size_type   _recordsPerPage;
+	size_type   _readAhead;
+	size_type   _pageCount;
+
+	std::vector<Slot>  _slots;
+	// The slot holding each page, or -1
+	std::vector<long>  _slotOf;
+	// Pages waiting for the background thread
+	std::deque<size_type> _queue;
+	// Ticks every time a page is used
+	size_type          _clock;
+	// The last page used, which is never evicted
+	size_type          _current;
+	PagedStats         _stats;
+	bool               _stop;
+
+	std::mutex              _mutex;
+	std::condition_variable _changed;
+	std::thread             _reader;
+	// The file and record buffer used by the calling thread
+	std::ifstream       _file;
+	std::vector<Record> _records;
+
+	/*!
+	 * @brief Reads a page into a slot, without holding the lock
+	 */
+	void Read(std::ifstream &file, std::vector<Record> &records, size_type page, Slot &slot) {
+
+		const size_type first = page * _recordsPerPage;
+		const size_type count = std::min(_recordsPerPage, _size - first);
+		records.resize(count);
+		file.clear();
+		file.seekg(static_cast<std::streamoff>(first * sizeof(Record)));
+		file.read(reinterpret_cast<char *>(records.data()), static_cast<std::streamsize>(count * sizeof(Record)));
+		slot.objects.clear();
+		for (const Record &record : records) {
+			slot.objects.emplace_back(record);
+		}
+	}
+
+	/*!
+	 * @brief Picks the least recently used slot that is not loading and gives it to a page,
+	 * the lock must be held
+	 * @return The slot index, or the number of slots if the container is being destroyed
+	 */
+	size_type Claim(std::unique_lock<std::mutex> &lock, size_type page) {
+
+		for (;;) {
+			if (_stop) {
+				return _slots.size();
+			}
+			long best = -1;
+			for (size_type i = 0; i < _slots.size(); ++i) {
+				const Slot &candidate = _slots[i];
+				if (candidate.state == State::Loading || (candidate.state == State::Ready && candidate.page == _current)) {
+					continue;
+				}
+				if (best < 0 || candidate.lastUsed < _slots[best].lastUsed) {
+					best = static_cast<long>(i);
+				}
+			}
+			if (best >= 0) {
+				Slot &slot = _slots[best];
+				if (slot.state == State::Ready) {
+					_slotOf[slot.page] = -1;
+				}
+				slot.page = page;
+				slot.state = State::Loading;
+				slot.lastUsed = ++_clock;
+				_slotOf[page] = best;
+				return static_cast<size_type>(best);
+			}
+			// Every slot is loading or in use, wait for one to free up
+			_changed.wait(lock);
+		}
+	}
+
+	/*!
+	 * @brief Queues the pages after a page for the background thread, the lock must be held
+	 */
+	void QueueReadAhead(size_type page) {
+
+		for (size_type next = page + 1; next <= page + _readAhead && next < _pageCount; ++next) {
+			if (_slotOf[next] < 0 && std::find(_queue.begin(), _queue.end(), next) == _queue.end()) {
+				_queue.push_back(next);
+			}
+		}
+		_changed.notify_all();
+	}
+
+	/*!
+	 * @brief The background thread, loads queued pages until the container is destroyed
+	 */
+	void ReadAhead() {
+
+		std::ifstream file(_path, std::ios::binary);
+		std::vector<Record> records;
+		std::unique_lock<std::mutex> lock(_mutex);
+		for (;;) {
+			_changed.wait(lock, [this]() { return _stop || !_queue.empty(); });
+			if (_stop) {
+				return;
+			}
+			const size_type page = _queue.front();
+			_queue.pop_front();
+			// Skip pages that are already in memory or that the reader has moved past
+			if (_slotOf[page] >= 0 || page <= _current || page > _current + _readAhead) {
+				continue;
+			}
+			const size_type index = Claim(lock, page);
+			if (index == _slots.size()) {
+				return;
+			}
+			Slot &slot = _slots[index];
+			lock.unlock();
+			Read(file, records, page, slot);
+			lock.lock();
+			slot.state = State::Ready;
+			slot.readAhead = true;
+			++_stats.pagesRead;
+			_changed.notify_all();
+		}
+	}
+
+	/*!
+	 * @brief Makes sure a page is in memory, loading it on this thread if needed
+	 * @return The slot holding the page
+	 */
+	Slot &Page(size_type page) {
+
+		std::unique_lock<std::mutex> lock(_mutex);
+		_current = page;
+		long index = _slotOf[page];
+		if (index < 0 || _slots[index].state != State::Ready) {
+			const auto start = std::chrono::steady_clock::now();
+			if (index < 0) {
+				// Nobody is loading it, read it here
+				++_stats.faults;
+				Slot &slot = _slots[Claim(lock, page)];
+				lock.unlock();
+				Read(_file, _records, page, slot);
+				lock.lock();
+				slot.state = State::Ready;
+				++_stats.pagesRead;
+				_changed.notify_all();
+			} else {
+				// The background thread is on it
+				++_stats.stalls;
+				_changed.wait(lock, [&]() {
+					return _slotOf[page] >= 0 && _slots[_slotOf[page]].state == State::Ready;
+				});
+				_slots[_slotOf[page]].readAhead = false;
+			}
+			const std::chrono::duration<double> waited = std::chrono::steady_clock::now() - start;
+			_stats.stallSeconds += waited.count();
+			index = _slotOf[page];
+		} else if (_slots[index].readAhead) {
+			++_stats.readAheadHits;
+			_slots[index].readAhead = false;
+		}
+		Slot &slot = _slots[index];
+		slot.lastUsed = ++_clock;
+		QueueReadAhead(page);
+		return slot;
+	}
+
+public:
+
+	/*!
+	 * @brief Opens a file of records
+	 * @param path The file written by WriteRecords
+	 * @param recordsPerPage The number of records in a page
+	 * @param residentPages The number of pages kept in memory, at least readAhead + 2
+	 * @param readAhead The number of pages to read ahead of the last page used
+	 */
+	PagedContainer(const std::string &path, size_type recordsPerPage, size_type residentPages, size_type readAhead = 2)
+			: _path(path), _size(0), _recordsPerPage(recordsPerPage ? recordsPerPage : 1), _readAhead(readAhead),
+			  _pageCount(0), _slots(std::max(residentPages, readAhead + 2)), _clock(0), _current(0), _stop(false),
+			  _file(path, std::ios::binary | std::ios::ate) {
+
+		if (_file) {
+			_size = static_cast<size_type>(_file.tellg()) / sizeof(Record);
+		}
+		_pageCount = (_size + _recordsPerPage - 1) / _recordsPerPage;
+		_slotOf.assign(_pageCount, -1);
+		for (Slot &slot : _slots) {
+			slot.objects.reserve(_recordsPerPage);
+		}
+		_reader = std::thread(&PagedContainer::ReadAhead, this);
+	}
+
+	PagedContainer(const PagedContainer &) = delete;
+
+	PagedContainer &operator=(const PagedContainer &) = delete;
+
+	/*!
+	 * @brief Stops the background thread
+	 */
+	~PagedContainer() {
+
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			_stop = true;
+		}
+		_changed.notify_all();
+		_reader.join();
+	}
+
+	/*!
+	 * @brief Gets the number of elements in the file
+	 * @return The number of elements
+	 */
+	size_type size() const noexcept(true) {
+
+		return _size;
+	}
+
+	/*!
+	 * @brief Gets an element, loading its page if needed
+	 * @param index The element to get
+	 * @return A reference that is good until the page leaves the window
+	 */
+	Object &operator[](size_type index) {
+
+		return Page(index / _recordsPerPage).objects[index % _recordsPerPage];
+	}
+
+	/*!
+	 * @brief Gets the rest of the page an element is on, loading it if needed
+	 * @param index The element to start at
+	 * @param available Set to the number of elements from index to the end of the page
+	 * @return A pointer to the element, the rest of the page follows it
+	 */
+	Object *PageFrom(size_type index, size_type &available) {
+
+		Slot &slot = Page(index / _recordsPerPage);
+		const size_type offset = index % _recordsPerPage;
+		available = slot.objects.size() - offset;
+		return slot.objects.data() + offset;
+	}
+
+	/*!
+	 * @brief Gets a copy of the counters
+	 * @return The counters
+	 */
+	PagedStats Stats() {
+
+		std::lock_guard<std::mutex> lock(_mutex);
+		return _stats;
+	}
+
+	/*!
+	 * @brief Gets an iterator to the first element
+	 * @return An iterator to the first element
+	 */
+	iterator begin() noexcept(true) {
+
+		return iterator(*this, 0);
+	}
+
+	/*!
+	 * @brief Gets an iterator past the last element
+	 * @return An iterator past the last element
+	 */
+	iterator end() noexcept(true) {
+
+		return iterator(*this, _size);
+	}
+};
+
+/*!
+ * @brief The iterator for a PagedContainer
+ * @tparam Container The PagedContainer type
+ */
+template<typename Container>
+class PagedIterator
+{
+public:
+	// User friendly names for data types
+	using iterator_category = std::random_access_iterator_tag;
+	using value_type = typename Container::value_type;
+	using difference_type = long;
+	using pointer = value_type *;
+	using reference = value_type &;
+	using container_type = Container;
+
+private:
+	Container  *_owner;
+	std::size_t _index;
+
+public:
+
+	PagedIterator(Container &owner, std::size_t index) noexcept(true) : _owner(&owner), _index(index) {
+	}
+
+	reference operator*() const {
+
+		return (*_owner)[_index];
+	}
+
+	pointer operator->() const {
+
+		return &(*_owner)[_index];
+	}
+
+	PagedIterator &operator++() noexcept(true) {
+
+		++_index;
+		return *this;
+	}
+
+	PagedIterator operator++(int) noexcept(true) {
+
+		PagedIterator copy(*this);
+		++_index;
+		return copy;
+	}
+
+	PagedIterator &operator--() noexcept(true) {
+
+		--_index;
+		return *this;
+	}
+
+	PagedIterator operator--(int) noexcept(true) {
+
+		PagedIterator copy(*this);
+		--_index;
+		return copy;
+	}
+
+	PagedIterator &operator+=(difference_type count) noexcept(true) {
+
+		_index += count;
+		return *this;
+	}
+
+	PagedIterator &operator-=(difference_type count) noexcept(true) {
+
+		_index -= count;
+		return *this;
+	}
+
+	PagedIterator operator+(difference_type count) const noexcept(true) {
+
+		return PagedIterator(*_owner, _index + count);
+	}
+
+	friend PagedIterator operator+(difference_type count, const PagedIterator &rhs) noexcept(true) {
+
+		return rhs + count;
+	}
+
+	PagedIterator operator-(difference_type count) const noexcept(true) {
+
+		return PagedIterator(*_owner, _index - count);
+	}
+
+	difference_type operator-(const PagedIterator &rhs) const noexcept(true) {
+
+		return static_cast<difference_type>(_index) - static_cast<difference_type>(rhs._index);
+	}
+
+	reference operator[](difference_type count) const {
+
+		return (*_owner)[_index + count];
+	}
+
+	bool operator<(const PagedIterator &rhs) const noexcept(true) {
+
+		return _index < rhs._index;
+	}
+
+	bool operator>(const PagedIterator &rhs) const noexcept(true) {
+
+		return rhs < *this;
+	}
+
+	bool operator<=(const PagedIterator &rhs) const noexcept(true) {
+
+		return !(rhs < *this);
+	}
+
+	bool operator>=(const PagedIterator &rhs) const noexcept(true) {
+
+		return !(*this < rhs);
+	}
+
+	bool operator==(const PagedIterator &rhs) const noexcept(true) {
+
+		return _index == rhs._index && _owner == rhs._owner;
+	}
+
+	bool operator!=(const PagedIterator &rhs) const noexcept(true) {
+
+		return !(*this == rhs);
+	}
+
+	Container &Owner() const noexcept(true) {
+
+		return *_owner;
+	}
+
+	std::size_t Index() const noexcept(true) {
+
+		return _index;
+	}
+};
+
+/*!
+ * @brief The iterator wrapper for PagedIterators
+ * @details
+ *      Batches are filled from one page at a time, so the container's lock
+ *      is taken once per page instead of once per element
+ * @tparam T The base class type
+ * @tparam U The PagedIterator type
+ */
+template<typename T, typename U>
+class IteratorWrapperPaged : public IteratorWrapper<T, U>
+{
+	typedef typename make_const<U>::type CU;
+
+public:
+
+	/*!
+	 * @brief Conversion constructor, takes an iterator
+	 * @param iterator The iterator to store internally
+	 */
+	explicit IteratorWrapperPaged(CU &iterator) noexcept(true) : IteratorWrapper<T, U>(iterator) {
+	}
+
+	/*!
+	 * @brief Default destructor
+	 */
+	virtual ~IteratorWrapperPaged() noexcept(true) = default;
+
+	/*!
+	 * @brief Batched increment, writes the addresses of up to count elements
+	 * from the current page into out and moves this iterator past them
+	 * @param out The array to write the element addresses into
+	 * @param count The size of the out array
+	 * @param end The iterator to stop at
+	 * @return The number of addresses written
+	 */
+	virtual std::size_t Batch(T **out, std::size_t count, const Iterator<T> &end) noexcept(true) {
+
+		U &it = IteratorWrapper<T, U>::_it;
+		const U &last = reinterpret_cast<const IteratorWrapperPaged<T, U> &>(end)._it;
+		const auto remaining = static_cast<std::size_t>(last - it);
+		if (remaining == 0 || count == 0) {
+			return 0;
+		}
+		std::size_t available;
+		auto *element = it.Owner().PageFrom(it.Index(), available);
+		if (available > remaining) {
+			available = remaining;
+		}
+		if (available > count) {
+			available = count;
+		}
+		for (std::size_t i = 0; i < available; ++i) {
+			out[i] = element + i;
+		}
+		it += static_cast<typename U::difference_type>(available);
+		return available;
+	}
+
+	/*!
+	 * @brief Copies this iterator
+	 * @return A new, identical iterator
+	 */
+	virtual Iterator<T> *Copy() const noexcept(true) {
+
+		return new IteratorWrapperPaged(IteratorWrapper<T, U>::_it);
+	}
+};
+
+/*!
+ * @brief Creates an iterator over a PagedContainer
+ * @tparam T The base type (must be specified)
+ * @tparam Container The PagedContainer type (can be deduced)
+ * @param iterator The iterator to store internally
+ * @return A new iterator
+ */
+template<typename T, typename Container>
+Iterator<T> MakeIterator(const PagedIterator<Container> &iterator) {
+
+	return static_cast<Iterator<T>>(*new IteratorWrapperPaged<T, PagedIterator<Container>>(iterator));
+}
+
+#endif //TEMPL_ITERATOR_PAGED_CONTAINER_H
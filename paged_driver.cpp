@@ -0,0 +1,128 @@
+/*!
+ * @file paged_driver.cpp
+ * @author Saadiq Daniels
+ * @date 18/10/2026
+ * @version 1.0
+ */
+
+#include <cstdio>
+#include <iostream>
+#include <vector>
+
+#include "iterator.h"
+#include "paged_container.h"
+#include "base.h"
+#include "benchmark.h"
+
+/*!
+ * The record stored in the file for every derived1
+ */
+struct derived1_record
+{
+	float number;
+};
+
+/*!
+ * A derived1 loaded from a derived1_record
+ */
+class paged_derived1 : public derived1
+{
+public:
+	/*!
+	 * Deserialises a record
+	 * @param record The record read from the file
+	 */
+	explicit paged_derived1(const derived1_record &record) : derived1(record.number) {
+	}
+};
+
+/*!
+ * Tests streaming a file bigger than the resident window through Iterator<base>
+ * @return 0
+ */
+int main() {
+
+	// Creating data //
+
+	const char *path = "paged_driver.bin";
+	const std::size_t count = 1 << 20;
+	std::vector<derived1_record> records(count);
+	double expected = 0.0;
+	for (std::size_t i = 0; i < count; ++i) {
+		records[i].number = static_cast<float>(i % 100);
+		expected += records[i].number;
+	}
+	if (!WriteRecords(path, records.data(), records.size())) {
+		std::cout << "Could not write " << path << std::endl;
+		return 1;
+	}
+
+	int result = 0;
+	{
+		// 4096 records per page, 8 pages in memory, reading 4 ahead
+		PagedContainer<derived1_record, paged_derived1> paged(path, 4096, 8, 4);
+		Iterator<const base> paged_begin = MakeIterator<const base>(paged.begin());
+		Iterator<const base> paged_end = MakeIterator<const base>(paged.end());
+
+		// Printing the first few elements //
+		std::cout << "Paged_Derived1:" << std::endl;
+		Iterator<const base> it(paged_begin);
+		for (int i = 0; i < 10; ++i, ++it) {
+			std::cout << "(" << it->getInt() << ", " << (*it).getfloat() << ")\t";
+		}
+		std::cout << std::endl;
+
+		// Streaming the whole file //
+		double sums[2] = {};
+		double time = Benchmark(3, [&]() {
+			double sum = 0.0;
+			for (Iterator<const base> current(paged_begin); current != paged_end; ++current) {
+				sum += current->getfloat();
+			}
+			sums[0] = sum;
+		});
+		Report("Paged Iterator<const base> loop", time, count, count * sizeof(derived1_record));
+
+		time = Benchmark(3, [&]() {
+			double sum = 0.0;
+			ForEach(paged_begin, paged_end, [&sum](const base &rhs) {
+				sum += rhs.getfloat();
+			});
+			sums[1] = sum;
+		});
+		Report("Paged ForEach", time, count, count * sizeof(derived1_record));
+
+		PagedStats stats = paged.Stats();
+		std::cout << "Pages read: " << stats.pagesRead << ", read ahead hits: " << stats.readAheadHits
+		          << ", stalls: " << stats.stalls << ", faults: " << stats.faults
+		          << ", stall time: " << stats.stallSeconds * 1000.0 << " ms" << std::endl;
+
+		if (sums[0] != expected || sums[1] != expected) {
+			std::cout << "Sums do not match" << std::endl;
+			result = 1;
+		}
+	}
+	{
+		// The smallest window, which is raised to room for the page in use,
+		// two read ahead pages and a spare. The destructor must not wait on
+		// the read ahead thread forever.
+		PagedContainer<derived1_record, paged_derived1> small(path, 10, 1, 2);
+		double sum = 0.0;
+		ForEach(MakeIterator<const base>(small.begin()), MakeIterator<const base>(small.end()),
+		        [&sum](const base &rhs) {
+			sum += rhs.getfloat();
+		});
+		// The random access operators, as the standard algorithms use them
+		const auto middle = small.begin() + 1234;
+		const bool random_access = middle[5].getfloat() == 39.f && (middle - 4)->getfloat() == 30.f &&
+		                           std::distance(small.begin(), middle) == 1234 && small.begin() < middle &&
+		                           std::next(middle, 2) > middle;
+		std::cout << "Smallest window: sum " << (sum == expected ? "matches" : "does not match") << std::endl;
+		if (sum != expected || !random_access) {
+			result = 1;
+		}
+	}
+	std::remove(path);
+
+	return result;
+}
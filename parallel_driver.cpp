@@ -0,0 +1,141 @@
+/*!
+ * @file parallel_driver.cpp
+ * @author Saadiq Daniels
+ * @date 18/10/2026
+ * @version 1.0
+ */
+
+#include <iostream>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+#include "iterator.h"
+#include "iterator_parallel.h"
+#include "base.h"
+#include "benchmark.h"
+
+/*!
+ * Counts the elements of every piece of a split range
+ * @param name The name to print
+ * @param range The range to split
+ * @param parts The number of pieces to ask for
+ * @return The number of elements in all of the pieces
+ */
+template<typename T>
+std::size_t PrintSplit(const std::string &name, const Range<T> &range, std::size_t parts) {
+
+	std::size_t total = 0;
+	std::cout << name << " split into:";
+	for (const Range<T> &piece : range.Split(parts)) {
+		const auto size = static_cast<std::size_t>(piece.begin() - piece.end());
+		std::cout << " " << size;
+		total += size;
+	}
+	std::cout << std::endl;
+	return total;
+}
+
+/*!
+ * Checks that doNothing was called the same number of times on every element
+ * @param container The map of derived4 objects
+ * @param calls The number of calls expected
+ * @return True if every element was called that many times
+ */
+template<typename Container>
+bool CheckCalls(const Container &container, int calls) {
+
+	for (const auto &element : container) {
+		if (element.second.getCalls() != calls) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/*!
+ * Tests walking keyed containers from several threads
+ * @return 0
+ */
+int main() {
+
+	// Creating data //
+
+	const int count = 1 << 20;
+	std::unordered_map<int, derived4> derived4_hash;
+	std::map<int, derived4> derived4_map;
+	std::map<derived1, int> derived1_map;
+	std::vector<derived4> derived4_vector(count / 4, derived4(1.f));
+	derived4_hash.reserve(count);
+	for (int i = 0; i < count; ++i) {
+		derived4_hash.emplace(i * 7, static_cast<float>(i % 100));
+		derived4_map.emplace(i * 7, static_cast<float>(i % 100));
+	}
+	for (int i = 0; i < 1000; ++i) {
+		derived1_map.emplace(derived1(static_cast<float>(i)), i);
+	}
+
+	// Splitting, the hash table by bucket and the maps by key //
+	const Range<base> hash_range = MakeRangeRight<base>(derived4_hash);
+	const Range<base> map_range = MakeRangeRight<base>(derived4_map);
+	const Range<const base> keys_range = MakeRangeLeft<const base>(derived1_map);
+	if (PrintSplit("Derived4_Hash", hash_range, 8) != derived4_hash.size() ||
+	    PrintSplit("Derived4_Map", map_range, 8) != derived4_map.size() ||
+	    PrintSplit("Derived1_Map", keys_range, 8) != derived1_map.size()) {
+		std::cout << "Pieces do not cover the container" << std::endl;
+		return 1;
+	}
+
+	// Benchmarking //
+
+	ThreadPool pool;
+	std::cout << "Running on " << pool.Size() << " threads" << std::endl;
+	const int runs = 5;
+	const auto call = [](base &rhs) {
+		rhs.doNothing();
+	};
+
+	double time = Benchmark(runs, [&]() {
+		ForEach(hash_range, call);
+	});
+	Report("unordered_map ForEach", time, count, count * sizeof(derived4));
+
+	time = Benchmark(runs, [&]() {
+		ParallelForEach(hash_range, pool, call);
+	});
+	Report("unordered_map ParallelForEach", time, count, count * sizeof(derived4));
+
+	time = Benchmark(runs, [&]() {
+		ForEach(map_range, call);
+	});
+	Report("map ForEach", time, count, count * sizeof(derived4));
+
+	time = Benchmark(runs, [&]() {
+		ParallelForEach(map_range, pool, call);
+	});
+	Report("map ParallelForEach", time, count, count * sizeof(derived4));
+
+	// A vector has no splitter, it is cut by position and neighbouring
+	// pieces meet at the same cut, so build with -DITERATOR_TSAN=ON to check
+	// that the pieces share no reference counts. The pool always has several
+	// threads, even on one core, so there is something to race.
+	ThreadPool workers(pool.Size() < 4 ? 4 : pool.Size());
+	const Range<base> vector_range = MakeRange<base>(derived4_vector);
+	time = Benchmark(runs, [&]() {
+		ParallelForEach(vector_range, workers, call);
+	});
+	const auto vector_size = static_cast<double>(derived4_vector.size());
+	Report("vector ParallelForEach", time, vector_size, vector_size * sizeof(derived4));
+	bool vector_calls = true;
+	for (const derived4 &element : derived4_vector) {
+		vector_calls = vector_calls && element.getCalls() == runs;
+	}
+
+	// Every element should have been visited once per run //
+	if (!CheckCalls(derived4_hash, 2 * runs) || !CheckCalls(derived4_map, 2 * runs) || !vector_calls) {
+		std::cout << "Call counts do not match" << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
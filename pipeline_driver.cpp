@@ -0,0 +1,99 @@
+/*!
+ * @file pipeline_driver.cpp
+ * @author Saadiq Daniels
+ * @date 18/10/2026
+ * @version 1.0
+ */
+
+#include <iostream>
+#include <list>
+#include <vector>
+
+#include "iterator.h"
+#include "iterator_pipeline.h"
+#include "base.h"
+#include "benchmark.h"
+
+/*!
+ * Tests lazy pipelines over Iterator<T> ranges and native iterators
+ * @return 0
+ */
+int main() {
+
+	// Creating data //
+
+	std::list<derived1> derived1_list;
+	std::vector<derived2> derived2_vector;
+	for (int i = 0; i < 100; ++i) {
+		derived1_list.emplace_back(static_cast<float>(i));
+		derived2_vector.emplace_back(static_cast<float>(i));
+	}
+
+	// Keep the floats divisible by three, drop the first two, take the next five and print their floats //
+	Range<const base> derived1_range = MakeRange<const base>(derived1_list);
+
+	std::cout << "Derived1_List pipeline:" << std::endl;
+	From(derived1_range)
+			.Filter([](const base &rhs) { return static_cast<int>(rhs.getfloat()) % 3 == 0; })
+			.Skip(2)
+			.Take(5)
+			.Transform([](const base &rhs) { return rhs.getfloat(); })
+			.ForEach([](float number) { std::cout << number << "\t"; });
+	std::cout << std::endl;
+
+	// The same pipeline straight over the vector's iterators //
+	std::cout << "Derived2_Vector pipeline:" << std::endl;
+	From(derived2_vector.begin(), derived2_vector.end())
+			.Filter([](const derived2 &rhs) { return static_cast<int>(rhs.getfloat()) % 3 == 0; })
+			.Skip(2)
+			.Take(5)
+			.Transform([](const derived2 &rhs) { return rhs.getfloat(); })
+			.ForEach([](float number) { std::cout << number << "\t"; });
+	std::cout << std::endl;
+
+	// Benchmarking //
+
+	const int count = 1 << 20;
+	std::vector<derived1> derived1_vector;
+	derived1_vector.reserve(count);
+	for (int i = 0; i < count; ++i) {
+		derived1_vector.emplace_back(static_cast<float>(i % 100));
+	}
+	Range<base> vector_range = MakeRange<base>(derived1_vector);
+	const std::size_t take = count / 2;
+	float sums[2] = {};
+
+	double time = Benchmark(10, [&]() {
+		float sum = 0.f;
+		std::size_t taken = 0;
+		Iterator<base> it = vector_range.begin();
+		Iterator<base> end = vector_range.end();
+		for (; it != end && taken < take; ++it) {
+			if (it->getfloat() >= 10.f) {
+				sum += it->getfloat();
+				++taken;
+			}
+		}
+		sums[0] = sum;
+	});
+	Report("Iterator<base> loop with conditionals", time, count, count * sizeof(derived1));
+
+	time = Benchmark(10, [&]() {
+		float sum = 0.f;
+		From(vector_range)
+				.Filter([](const base &rhs) { return rhs.getfloat() >= 10.f; })
+				.Take(take)
+				.Transform([](const base &rhs) { return rhs.getfloat(); })
+				.ForEach([&sum](float number) { sum += number; });
+		sums[1] = sum;
+	});
+	Report("Filter | Take | Transform pipeline", time, count, count * sizeof(derived1));
+
+	KeepAlive(sums[0] + sums[1]);
+	if (sums[0] != sums[1]) {
+		std::cout << "Sums do not match" << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,131 @@
+/*!
+ * @file poly_driver.cpp
+ * @author Saadiq Daniels
+ * @date 18/10/2026
+ * @version 1.0
+ */
+
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "iterator.h"
+#include "poly_vector.h"
+#include "base.h"
+#include "benchmark.h"
+
+/*!
+ * Tests storing and iterating over mixed derived classes grouped by type
+ * @return 0
+ */
+int main() {
+
+	// Creating data //
+
+	PolyVector<base> small;
+	for (int i = 0; i < 9; ++i) {
+		switch (i % 3) {
+			case 0:
+				small.emplace_back<derived1>(static_cast<float>(i));
+				break;
+			case 1:
+				small.emplace_back<derived2>(static_cast<float>(i));
+				break;
+			default:
+				small.emplace_back<derived3>(static_cast<float>(i));
+				break;
+		}
+	}
+
+	// Printing the container, objects come out grouped by type //
+	std::cout << "PolyVector (" << small.Types() << " types):" << std::endl;
+	for (Iterator<const base> it = MakeIterator<const base>(small.begin()),
+			     end = MakeIterator<const base>(small.end()); it != end; ++it) {
+		std::cout << "(" << it->getInt() << ", " << (*it).getfloat() << ")\t";
+	}
+	std::cout << std::endl;
+
+	ForEachSegment(MakeRange<base>(small), [](const Span<base> &segment) {
+		std::cout << "Segment of " << segment.count << " objects " << segment.stride << " bytes apart" << std::endl;
+	});
+
+	// Benchmarking //
+
+	// The same random mix of types stored as one heap allocation per object
+	// and in a PolyVector
+	const int count = 1 << 20;
+	std::mt19937 random(42);
+	std::vector<std::unique_ptr<base>> owners;
+	owners.reserve(count);
+	PolyVector<base> poly;
+	for (int i = 0; i < count; ++i) {
+		const float number = static_cast<float>(i % 100);
+		switch (random() % 3) {
+			case 0:
+				owners.emplace_back(std::make_unique<derived1>(number));
+				poly.emplace_back<derived1>(number);
+				break;
+			case 1:
+				owners.emplace_back(std::make_unique<derived2>(number));
+				poly.emplace_back<derived2>(number);
+				break;
+			default:
+				owners.emplace_back(std::make_unique<derived3>(number));
+				poly.emplace_back<derived3>(number);
+				break;
+		}
+	}
+	std::shuffle(owners.begin(), owners.end(), random);
+
+	const Range<base> owners_range = MakeRangeIndirect<base>(owners);
+	const Range<base> poly_range = MakeRange<base>(poly);
+	double sums[4] = {};
+
+	double time = Benchmark(5, [&]() {
+		double sum = 0.0;
+		ForEach(owners_range, [&sum](const base &rhs) {
+			sum += rhs.getfloat();
+		});
+		sums[0] = sum;
+	});
+	Report("unique_ptr ForEach", time, count, count * sizeof(derived1));
+
+	time = Benchmark(5, [&]() {
+		double sum = 0.0;
+		for (Iterator<base> it = poly_range.begin(), end = poly_range.end(); it != end; ++it) {
+			sum += it->getfloat();
+		}
+		sums[1] = sum;
+	});
+	Report("PolyVector Iterator<base> loop", time, count, count * sizeof(derived1));
+
+	time = Benchmark(5, [&]() {
+		double sum = 0.0;
+		ForEach(poly_range, [&sum](const base &rhs) {
+			sum += rhs.getfloat();
+		});
+		sums[2] = sum;
+	});
+	Report("PolyVector ForEach", time, count, count * sizeof(derived1));
+
+	time = Benchmark(5, [&]() {
+		double sum = 0.0;
+		ForEachSegment(poly_range, [&sum](const Span<base> &segment) {
+			for (std::size_t i = 0; i < segment.count; ++i) {
+				sum += segment[i].getfloat();
+			}
+		});
+		sums[3] = sum;
+	});
+	Report("PolyVector ForEachSegment", time, count, count * sizeof(derived1));
+
+	KeepAlive(sums[0] + sums[1] + sums[2] + sums[3]);
+	if (sums[0] != sums[1] || sums[1] != sums[2] || sums[2] != sums[3]) {
+		std::cout << "Sums do not match" << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,534 @@
+/*!
+ * @file poly_vector.h
+ * @author Saadiq Daniels
+ * @date 18/10/2026
+ * @version 1.0
+ * @brief
+ * 	A container for objects of many classes derived from one base class,
+ * 	which stores every derived class in its own arena so objects of the
+ * 	same type sit next to each other in memory
+ */
+
+#ifndef TEMPL_ITERATOR_POLY_VECTOR_H
+#define TEMPL_ITERATOR_POLY_VECTOR_H
+
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+#include "iterator.h"
+
+// The number of objects in the first block of each arena, later blocks double in size
+#ifndef POLY_VECTOR_FIRST_BLOCK
+#define POLY_VECTOR_FIRST_BLOCK 64
+#endif
+
+// The largest number of objects in one block
+#ifndef POLY_VECTOR_MAX_BLOCK
+#define POLY_VECTOR_MAX_BLOCK 4096
+#endif
+
+template<typename Base>
+class PolyIterator;
+
+/*!
+ * @brief A container of objects derived from Base, grouped by their exact type
+ * @details
+ *      Each derived class gets an arena made of blocks, and objects are
+ *      constructed in place in the last block of their arena. Blocks are
+ *      never moved or resized, so references to the objects stay valid until
+ *      the container is cleared, and adding an object never allocates more
+ *      than one block. Iteration visits the arenas in the order their types
+ *      were first added, not the order the objects were added.
+ * @tparam Base The base class of every object in the container
+ */
+template<typename Base>
+class PolyVector
+{
+public:
+	// User friendly names for data types
+	using value_type = Base;
+	using size_type = std::size_t;
+	using iterator = PolyIterator<Base>;
+
+	friend class PolyIterator<Base>;
+
+private:
+	// A block of objects of one type
+	struct Block
+	{
+		// The storage for the objects
+		unsigned char *data;
+		// The number of objects constructed in the block
+		std::size_t   count;
+		// The number of objects the block has room for
+		std::size_t   capacity;
+	};
+
+	// The arena for one derived class
+	struct Arena
+	{
+		// The derived class stored in the arena
+		const std::type_info *type;
+		// The size of the derived class, also the distance between objects
+		std::size_t          size;
+		// The alignment of the derived class
+		std::size_t          align;
+		// The distance from the start of an object to its Base part
+		std::ptrdiff_t       offset;
+		// Destroys an object of the derived class
+		void (*destroy)(void *);
+		// The blocks, oldest first
+		std::vector<Block>   blocks;
+	};
+
+	// One arena for every derived class added so far
+	std::vector<Arena> _arenas;
+	// The number of objects in the container
+	size_type          _size;
+	// The arena that was used last, checked first when adding
+	std::size_t        _last;
+
+	/*!
+	 * @brief Finds the arena for a derived class, making it if needed
+	 * @tparam D The derived class
+	 * @return The arena
+	 */
+	template<typename D>
+	Arena &ArenaFor() {
+
+		if (_last < _arenas.size() && *_arenas[_last].type == typeid(D)) {
+			return _arenas[_last];
+		}
+		for (_last = 0; _last < _arenas.size(); ++_last) {
+			if (*_arenas[_last].type == typeid(D)) {
+				return _arenas[_last];
+			}
+		}
+		_arenas.push_back(Arena{&typeid(D), sizeof(D), alignof(D), 0, [](void *object) {
+			static_cast<D *>(object)->~D();
+		}, {}});
+		return _arenas.back();
+	}
+
+	/*!
+	 * @brief Gets a block with room for one more object, adding one if the last is full
+	 * @param arena The arena to add to
+	 * @return The block
+	 */
+	static Block &Room(Arena &arena) {
+
+		if (arena.blocks.empty() || arena.blocks.back().count == arena.blocks.back().capacity) {
+			std::size_t capacity = arena.blocks.empty() ? POLY_VECTOR_FIRST_BLOCK : arena.blocks.back().capacity * 2;
+			if (capacity > POLY_VECTOR_MAX_BLOCK) {
+				capacity = POLY_VECTOR_MAX_BLOCK;
+			}
+			arena.blocks.reserve(arena.blocks.size() + 1);
+			auto *data = static_cast<unsigned char *>(::operator new(capacity * arena.size, std::align_val_t(arena.align)));
+			arena.blocks.push_back(Block{data, 0, capacity});
+		}
+		return arena.blocks.back();
+	}
+
+public:
+
+	/*!
+	 * @brief Default constructor
+	 */
+	PolyVector() noexcept(true) : _size(0), _last(0) {
+	}
+
+	/*!
+	 * @brief The objects are not copyable through the base class
+	 */
+	PolyVector(const PolyVector &) = delete;
+
+	/*!
+	 * @brief Move constructor
+	 * @param rhs The container to take the objects from
+	 */
+	PolyVector(PolyVector &&rhs) noexcept(true)
+			: _arenas(std::move(rhs._arenas)), _size(rhs._size), _last(0) {
+
+		rhs._arenas.clear();
+		rhs._size = 0;
+	}
+
+	/*!
+	 * @brief The objects are not copyable through the base class
+	 */
+	PolyVector &operator=(const PolyVector &) = delete;
+
+	/*!
+	 * @brief Move assignment operator
+	 * @param rhs The container to take the objects from
+	 * @return A reference to this container
+	 */
+	PolyVector &operator=(PolyVector &&rhs) noexcept(true) {
+
+		if (this != &rhs) {
+			clear();
+			_arenas = std::move(rhs._arenas);
+			_size = rhs._size;
+			rhs._arenas.clear();
+			rhs._size = 0;
+		}
+		return *this;
+	}
+
+	/*!
+	 * @brief Destructor, destroys every object
+	 */
+	~PolyVector() noexcept(true) {
+
+		clear();
+	}
+
+	/*!
+	 * @brief Constructs an object at the end of its type's arena
+	 * @tparam D The derived class to construct
+	 * @param args The arguments for the constructor of D
+	 * @return A reference to the new object, valid until the container is cleared
+	 */
+	template<typename D, typename... Args>
+	D &emplace_back(Args &&... args) {
+
+		static_assert(std::is_base_of<Base, D>::value, "PolyVector can only hold classes derived from Base");
+		Arena &arena = ArenaFor<D>();
+		Block &block = Room(arena);
+		D *object = new(block.data + block.count * sizeof(D)) D(std::forward<Args>(args)...);
+		arena.offset = reinterpret_cast<unsigned char *>(static_cast<Base *>(object)) - reinterpret_cast<unsigned char *>(object);
+		++block.count;
+		++_size;
+		return *object;
+	}
+
+	/*!
+	 * @brief Destroys every object and frees every block
+	 */
+	void clear() noexcept(true) {
+
+		for (Arena &arena : _arenas) {
+			for (Block &block : arena.blocks) {
+				for (std::size_t i = 0; i < block.count; ++i) {
+					arena.destroy(block.data + i * arena.size);
+				}
+				::operator delete(block.data, std::align_val_t(arena.align));
+			}
+		}
+		_arenas.clear();
+		_size = 0;
+		_last = 0;
+	}
+
+	/*!
+	 * @brief Gets the number of objects
+	 * @return The number of objects
+	 */
+	size_type size() const noexcept(true) {
+
+		return _size;
+	}
+
+	/*!
+	 * @brief Checks if there are no objects
+	 * @return True if the container is empty
+	 */
+	bool empty() const noexcept(true) {
+
+		return _size == 0;
+	}
+
+	/*!
+	 * @brief Gets the number of different derived classes stored
+	 * @return The number of arenas
+	 */
+	std::size_t Types() const noexcept(true) {
+
+		return _arenas.size();
+	}
+
+	/*!
+	 * @brief Gets an iterator to the first object
+	 * @return An iterator to the first object
+	 */
+	iterator begin() noexcept(true) {
+
+		return iterator(*this, 0, 0, 0);
+	}
+
+	/*!
+	 * @brief Gets an iterator past the last object
+	 * @return An iterator past the last object
+	 */
+	iterator end() noexcept(true) {
+
+		return iterator(*this, _arenas.size(), 0, 0);
+	}
+};
+
+/*!
+ * @brief The iterator for a PolyVector, walks one block at a time
+ * @tparam Base The base class of the container
+ */
+template<typename Base>
+class PolyIterator
+{
+public:
+	// User friendly names for data types
+	using iterator_category = std::forward_iterator_tag;
+	using value_type = Base;
+	using difference_type = long;
+	using pointer = Base *;
+	using reference = Base &;
+	using container_type = PolyVector<Base>;
+
+private:
+	// The container being iterated over
+	container_type *_owner;
+	// The arena of the current object
+	std::size_t    _arena;
+	// The block of the current object
+	std::size_t    _block;
+	// The index of the current object in its block
+	std::size_t    _index;
+
+	/*!
+	 * @brief Moves to the next block when the current one has been used up
+	 */
+	void Settle() noexcept(true) {
+
+		while (_arena < _owner->_arenas.size() && _index == _owner->_arenas[_arena].blocks[_block].count) {
+			_index = 0;
+			if (++_block == _owner->_arenas[_arena].blocks.size()) {
+				_block = 0;
+				++_arena;
+			}
+		}
+	}
+
+public:
+
+	/*!
+	 * @brief Conversion constructor
+	 * @param owner The container to iterate over
+	 * @param arena The arena to start in
+	 * @param block The block to start in
+	 * @param index The object to start at
+	 */
+	PolyIterator(container_type &owner, std::size_t arena, std::size_t block, std::size_t index) noexcept(true)
+			: _owner(&owner), _arena(arena), _block(block), _index(index) {
+
+		Settle();
+	}
+
+	/*!
+	 * @brief Dereference operator
+	 * @return A reference to the current object
+	 */
+	reference operator*() const noexcept(true) {
+
+		return *Address();
+	}
+
+	/*!
+	 * @brief Arrow operator
+	 * @return A pointer to the current object
+	 */
+	pointer operator->() const noexcept(true) {
+
+		return Address();
+	}
+
+	/*!
+	 * @brief Increment operator
+	 * @return A reference to this iterator
+	 */
+	PolyIterator &operator++() noexcept(true) {
+
+		++_index;
+		Settle();
+		return *this;
+	}
+
+	/*!
+	 * @brief Equality operator
+	 * @param rhs The iterator to compare with
+	 * @return True if both iterators point at the same object
+	 */
+	bool operator==(const PolyIterator &rhs) const noexcept(true) {
+
+		return _index == rhs._index && _block == rhs._block && _arena == rhs._arena;
+	}
+
+	/*!
+	 * @brief Inequality operator
+	 * @param rhs The iterator to compare with
+	 * @return False if both iterators point at the same object
+	 */
+	bool operator!=(const PolyIterator &rhs) const noexcept(true) {
+
+		return !(*this == rhs);
+	}
+
+	/*!
+	 * @brief Gets the Base part of the current object
+	 * @return A pointer to the current object
+	 */
+	pointer Address() const noexcept(true) {
+
+		const auto &arena = _owner->_arenas[_arena];
+		return reinterpret_cast<pointer>(arena.blocks[_block].data + _index * arena.size + arena.offset);
+	}
+
+	/*!
+	 * @brief Counts the objects left in the current block
+	 * @param last The iterator to stop at
+	 * @return The number of objects from this one to the end of the block, or to last
+	 * if it is in the same block
+	 */
+	std::size_t Run(const PolyIterator &last) const noexcept(true) {
+
+		if (_arena == last._arena && _block == last._block) {
+			return last._index - _index;
+		}
+		return _owner->_arenas[_arena].blocks[_block].count - _index;
+	}
+
+	/*!
+	 * @brief Gets the distance between objects in the current block
+	 * @return The size of the current object's type
+	 */
+	std::size_t Stride() const noexcept(true) {
+
+		return _owner->_arenas[_arena].size;
+	}
+
+	/*!
+	 * @brief Gets the exact type of the current object
+	 * @return The type of the current block's objects
+	 */
+	const std::type_info *Type() const noexcept(true) {
+
+		return _owner->_arenas[_arena].type;
+	}
+
+	/*!
+	 * @brief Moves forward inside the current block
+	 * @param count The number of objects to skip, no more than Run
+	 * @return A reference to this iterator
+	 */
+	PolyIterator &Skip(std::size_t count) noexcept(true) {
+
+		_index += count;
+		Settle();
+		return *this;
+	}
+};
+
+/*!
+ * @brief The iterator wrapper for PolyIterators
+ * @details
+ *      Batch and Segments work out where a block's objects are once per
+ *      block instead of stepping the iterator for every object
+ * @tparam T The base class type
+ * @tparam U The PolyIterator type
+ */
+template<typename T, typename U>
+class IteratorWrapperPoly : public IteratorWrapper<T, U>
+{
+	typedef typename make_const<U>::type CU;
+	typedef typename make_mutable<U>::type MU;
+
+public:
+
+	/*!
+	 * @brief Conversion constructor, takes an iterator
+	 * @param iterator The iterator to store internally
+	 */
+	explicit IteratorWrapperPoly(CU &iterator) noexcept(true) : IteratorWrapper<T, U>(iterator) {
+	}
+
+	/*!
+	 * @brief Default destructor
+	 */
+	virtual ~IteratorWrapperPoly() noexcept(true) = default;
+
+	/*!
+	 * @brief Batched increment, writes the addresses of up to count elements
+	 * into out and moves this iterator past them
+	 * @param out The array to write the element addresses into
+	 * @param count The size of the out array
+	 * @param end The iterator to stop at
+	 * @return The number of addresses written
+	 */
+	virtual std::size_t Batch(T **out, std::size_t count, const Iterator<T> &end) noexcept(true) {
+
+		MU       &it   = IteratorWrapper<T, U>::_it;
+		const MU &last = reinterpret_cast<const IteratorWrapperPoly<T, U> &>(end)._it;
+		std::size_t written = 0;
+		while (written < count && it != last) {
+			std::size_t run = it.Run(last);
+			if (run > count - written) {
+				run = count - written;
+			}
+			auto *first = reinterpret_cast<unsigned char *>(it.Address());
+			const std::size_t stride = it.Stride();
+			for (std::size_t i = 0; i < run; ++i) {
+				out[written + i] = reinterpret_cast<T *>(first + i * stride);
+			}
+			written += run;
+			it.Skip(run);
+		}
+		return written;
+	}
+
+	/*!
+	 * @brief Segmented increment, writes one run per block into out and moves
+	 * this iterator past them
+	 * @param out The array to write the runs into
+	 * @param count The size of the out array
+	 * @param end The iterator to stop at
+	 * @return The number of runs written
+	 */
+	virtual std::size_t Segments(Span<T> *out, std::size_t count, const Iterator<T> &end) noexcept(true) {
+
+		MU       &it   = IteratorWrapper<T, U>::_it;
+		const MU &last = reinterpret_cast<const IteratorWrapperPoly<T, U> &>(end)._it;
+		std::size_t written = 0;
+		for (; written < count && it != last; ++written) {
+			const std::size_t run = it.Run(last);
+			out[written] = Span<T>{it.Address(), run, it.Stride(), it.Type()};
+			it.Skip(run);
+		}
+		return written;
+	}
+
+	/*!
+	 * @brief Copies this iterator
+	 * @return A new, identical iterator
+	 */
+	virtual Iterator<T> *Copy() const noexcept(true) {
+
+		return new IteratorWrapperPoly(IteratorWrapper<T, U>::_it);
+	}
+};
+
+/*!
+ * @brief Creates an iterator over a PolyVector
+ * @tparam T The base type (must be specified)
+ * @tparam Base The container's base class (can be deduced)
+ * @param iterator The iterator to store internally
+ * @return A new iterator
+ */
+template<typename T, typename Base>
+Iterator<T> MakeIterator(const PolyIterator<Base> &iterator) {
+
+	return static_cast<Iterator<T>>(*new IteratorWrapperPoly<T, PolyIterator<Base>>(iterator));
+}
+
+#endif //TEMPL_ITERATOR_POLY_VECTOR_H
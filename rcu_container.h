@@ -0,0 +1,284 @@
+/*!
+ * @file rcu_container.h
+ * @author Saadiq Daniels
+ * @date 18/10/2026
+ * @version 1.0
+ * @brief
+ * 	A read-copy-update container: readers walk an immutable version while a
+ * 	writer builds and publishes the next one, and old versions are freed once
+ * 	no reader can still see them
+ */
+
+#ifndef TEMPL_ITERATOR_RCU_CONTAINER_H
+#define TEMPL_ITERATOR_RCU_CONTAINER_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "iterator.h"
+
+// The number of snapshots that can be held at the same time
+#ifndef RCU_READER_SLOTS
+#define RCU_READER_SLOTS 64
+#endif
+
+/*!
+ * @brief Shares a container between one or more writers and any number of
+ * readers without a lock around the walk
+ * @details
+ *      Read takes a free reader slot, writes the current epoch into it and
+ *      then loads the current version with one atomic load. The Snapshot it
+ *      returns walks that version, for example with
+ *      MakeRange<const Base>(snapshot), for as long as it is held, and gives
+ *      up the slot when it is destroyed.
+ *      Update copies the current version, changes the copy and publishes it
+ *      with one atomic store. The old version is retired with the epoch it
+ *      was replaced in, and the epoch moves on. A retired version is freed
+ *      once every held slot shows a later epoch, so a reader never waits for
+ *      a writer and a writer never waits for a reader. Writers wait for each
+ *      other. Each Update copies the whole container, so group the changes of
+ *      a frame into one Update.
+ * @tparam C The container type
+ */
+template<typename C>
+class RcuContainer
+{
+	/*!
+	 * @brief The epoch a reader started in, or 0 if the slot is free, on its
+	 * own cache line
+	 */
+	struct alignas(64) Slot
+	{
+		std::atomic<std::uint64_t> epoch{0};
+	};
+
+	// The published version
+	std::atomic<const C *>                            _current;
+	// Moves on every time a version is replaced, starts at 1
+	std::atomic<std::uint64_t>                        _epoch;
+	// The epochs of the readers holding snapshots
+	Slot                                              _slots[RCU_READER_SLOTS];
+	// Lets one writer through at a time
+	std::mutex                                        _writer;
+	// Replaced versions and the epochs they were replaced in, guarded by _writer
+	std::vector<std::pair<std::uint64_t, const C *>>  _retired;
+
+	/*!
+	 * @brief Publishes a new version and retires the old one, _writer must be held
+	 * @param next The new version
+	 */
+	void Publish(const C *next) {
+
+		const C *previous = _current.exchange(next, std::memory_order_seq_cst);
+		_retired.emplace_back(_epoch.fetch_add(1, std::memory_order_seq_cst), previous);
+		Collect();
+	}
+
+	/*!
+	 * @brief Frees the retired versions that no reader can see, _writer must be held
+	 * @return The number of versions freed
+	 */
+	std::size_t Collect() {
+
+		std::uint64_t oldest = _epoch.load(std::memory_order_seq_cst);
+		for (const Slot &slot : _slots) {
+			const std::uint64_t epoch = slot.epoch.load(std::memory_order_seq_cst);
+			if (epoch != 0 && epoch < oldest) {
+				oldest = epoch;
+			}
+		}
+		std::size_t kept = 0;
+		for (const std::pair<std::uint64_t, const C *> &retired : _retired) {
+			if (retired.first < oldest) {
+				delete retired.second;
+			} else {
+				_retired[kept++] = retired;
+			}
+		}
+		const std::size_t freed = _retired.size() - kept;
+		_retired.resize(kept);
+		return freed;
+	}
+
+public:
+
+	/*!
+	 * @brief A version of the container that will not change or be freed while it is held
+	 */
+	class Snapshot
+	{
+		// The container the version came from, or nullptr once moved from
+		RcuContainer *_owner;
+		// The reader slot held
+		std::size_t   _slot;
+		// The version
+		const C      *_version;
+
+	public:
+		// User friendly names for data types
+		using const_iterator = typename C::const_iterator;
+
+		/*!
+		 * @brief Conversion constructor, called by RcuContainer::Read
+		 * @param owner The container the version came from
+		 * @param slot The reader slot holding the version's epoch
+		 * @param version The version
+		 */
+		Snapshot(RcuContainer *owner, std::size_t slot, const C *version) noexcept(true)
+				: _owner(owner), _slot(slot), _version(version) {
+		}
+
+		/*!
+		 * @brief Move constructor
+		 * @param rhs The snapshot to take over, it no longer holds the version
+		 */
+		Snapshot(Snapshot &&rhs) noexcept(true) : _owner(rhs._owner), _slot(rhs._slot), _version(rhs._version) {
+
+			rhs._owner = nullptr;
+		}
+
+		Snapshot(const Snapshot &) = delete;
+		Snapshot &operator=(const Snapshot &) = delete;
+		Snapshot &operator=(Snapshot &&) = delete;
+
+		/*!
+		 * @brief Destructor, lets the version be freed once it has been replaced
+		 */
+		~Snapshot() noexcept(true) {
+
+			if (_owner) {
+				_owner->_slots[_slot].epoch.store(0, std::memory_order_release);
+			}
+		}
+
+		/*!
+		 * @brief Dereference operator
+		 * @return The version, for MakeRangeLeft and MakeRangeRight
+		 */
+		const C &operator*() const noexcept(true) {
+
+			return *_version;
+		}
+
+		/*!
+		 * @brief Arrow operator
+		 * @return The version
+		 */
+		const C *operator->() const noexcept(true) {
+
+			return _version;
+		}
+
+		/*!
+		 * @brief Gets the first element, so the snapshot can be passed to MakeRange
+		 * @return The version's cbegin()
+		 */
+		const_iterator begin() const noexcept(true) {
+
+			return _version->cbegin();
+		}
+
+		/*!
+		 * @brief Gets the end of the elements
+		 * @return The version's cend()
+		 */
+		const_iterator end() const noexcept(true) {
+
+			return _version->cend();
+		}
+	};
+
+	/*!
+	 * @brief Conversion constructor
+	 * @param container The first version
+	 */
+	explicit RcuContainer(C container = C()) : _current(new C(std::move(container))), _epoch(1) {
+	}
+
+	RcuContainer(const RcuContainer &) = delete;
+	RcuContainer &operator=(const RcuContainer &) = delete;
+
+	/*!
+	 * @brief Destructor, no snapshots may still be held
+	 */
+	~RcuContainer() {
+
+		for (const std::pair<std::uint64_t, const C *> &retired : _retired) {
+			delete retired.second;
+		}
+		delete _current.load(std::memory_order_relaxed);
+	}
+
+	/*!
+	 * @brief Takes a snapshot of the current version
+	 * @details
+	 *      If all RCU_READER_SLOTS slots are held this yields until one is
+	 *      given up, which only ever waits for other readers
+	 * @return A Snapshot that can be walked until it is destroyed
+	 */
+	Snapshot Read() noexcept(true) {
+
+		for (;;) {
+			const std::uint64_t epoch = _epoch.load(std::memory_order_seq_cst);
+			for (std::size_t i = 0; i < RCU_READER_SLOTS; ++i) {
+				std::uint64_t free = 0;
+				if (_slots[i].epoch.compare_exchange_strong(free, epoch, std::memory_order_seq_cst)) {
+					return Snapshot(this, i, _current.load(std::memory_order_seq_cst));
+				}
+			}
+			std::this_thread::yield();
+		}
+	}
+
+	/*!
+	 * @brief Changes a copy of the current version and publishes it
+	 * @tparam F The function type (can be deduced)
+	 * @param function Called with a C & holding a copy of the current version
+	 */
+	template<typename F>
+	void Update(F function) {
+
+		std::lock_guard<std::mutex> lock(_writer);
+		C *next = new C(*_current.load(std::memory_order_relaxed));
+		function(*next);
+		Publish(next);
+	}
+
+	/*!
+	 * @brief Publishes a whole new version
+	 * @param container The new version
+	 */
+	void Store(C container) {
+
+		std::lock_guard<std::mutex> lock(_writer);
+		Publish(new C(std::move(container)));
+	}
+
+	/*!
+	 * @brief Frees the retired versions that no reader can see, which Update
+	 * and Store also do
+	 * @return The number of versions freed
+	 */
+	std::size_t Reclaim() {
+
+		std::lock_guard<std::mutex> lock(_writer);
+		return Collect();
+	}
+
+	/*!
+	 * @brief Gets the number of retired versions that have not been freed
+	 * @return The number of versions waiting for readers to move on
+	 */
+	std::size_t Pending() {
+
+		std::lock_guard<std::mutex> lock(_writer);
+		return _retired.size();
+	}
+};
+
+#endif //TEMPL_ITERATOR_RCU_CONTAINER_H
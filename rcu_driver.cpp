@@ -0,0 +1,149 @@
+/*!
+ * @file rcu_driver.cpp
+ * @author Saadiq Daniels
+ * @date 18/10/2026
+ * @version 1.0
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "iterator.h"
+#include "rcu_container.h"
+#include "base.h"
+#include "benchmark.h"
+
+/*!
+ * Checks that every element of a range has the same float, which is true of
+ * every version the writer publishes
+ * @param range The range to walk
+ * @return True if the range is one whole version
+ */
+bool Whole(const Range<const base> &range) {
+
+	bool first = true;
+	float value = 0.f;
+	bool whole = true;
+	ForEach(range, [&](const base &rhs) {
+		if (first) {
+			value = rhs.getfloat();
+			first = false;
+		}
+		whole = whole && rhs.getfloat() == value;
+	});
+	return whole;
+}
+
+/*!
+ * Tests readers walking an RcuContainer while a writer publishes new versions,
+ * against readers and a writer sharing one lock
+ * @return 0, or 1 if a reader saw a half written version
+ */
+int main() {
+
+	// Copies of these are written, so that only the main thread bumps base's id counter
+	std::vector<derived4> prototypes;
+	for (int i = 0; i < 100; ++i) {
+		prototypes.emplace_back(static_cast<float>(i));
+	}
+	const std::size_t count = 1 << 14;
+	const std::size_t updates = 500;
+	const std::size_t readers = 2;
+	std::vector<derived4> initial(count, prototypes[0]);
+
+	// Read-copy-update //
+
+	RcuContainer<std::vector<derived4>> derived4_rcu(initial);
+	std::atomic<bool> done(false);
+	std::atomic<std::size_t> errors(0);
+	std::atomic<std::size_t> walks(0);
+	std::vector<std::thread> threads;
+	double time = Benchmark(1, [&]() {
+		for (std::size_t r = 0; r < readers; ++r) {
+			threads.emplace_back([&]() {
+				while (!done.load()) {
+					const RcuContainer<std::vector<derived4>>::Snapshot snapshot = derived4_rcu.Read();
+					if (!Whole(MakeRange<const base>(snapshot))) {
+						++errors;
+					}
+					++walks;
+				}
+			});
+		}
+		for (std::size_t v = 1; v <= updates; ++v) {
+			derived4_rcu.Update([&prototypes, v](std::vector<derived4> &next) {
+				for (derived4 &element : next) {
+					element = prototypes[v % prototypes.size()];
+				}
+			});
+		}
+		done = true;
+		for (std::thread &thread : threads) {
+			thread.join();
+		}
+	});
+	Report("RcuContainer, 500 updates with 2 readers", time, updates * count, updates * count * sizeof(derived4));
+	derived4_rcu.Reclaim();
+	std::cout << "Reader walks: " << walks << ", torn versions: " << errors << ", versions not freed: "
+	          << derived4_rcu.Pending() << std::endl;
+	const bool rcu_good = errors == 0 && derived4_rcu.Pending() == 0 &&
+	                      (*derived4_rcu.Read())[0].getfloat() == prototypes[updates % prototypes.size()].getfloat();
+
+	// One lock around every walk and update //
+
+	std::vector<derived4> derived4_locked(initial);
+	std::mutex lock;
+	done = false;
+	errors = 0;
+	walks = 0;
+	threads.clear();
+	time = Benchmark(1, [&]() {
+		for (std::size_t r = 0; r < readers; ++r) {
+			threads.emplace_back([&]() {
+				while (!done.load()) {
+					std::lock_guard<std::mutex> guard(lock);
+					if (!Whole(MakeRange<const base>(derived4_locked))) {
+						++errors;
+					}
+					++walks;
+				}
+			});
+		}
+		for (std::size_t v = 1; v <= updates; ++v) {
+			std::lock_guard<std::mutex> guard(lock);
+			for (derived4 &element : derived4_locked) {
+				element = prototypes[v % prototypes.size()];
+			}
+		}
+		done = true;
+		for (std::thread &thread : threads) {
+			thread.join();
+		}
+	});
+	Report("std::mutex, 500 updates with 2 readers", time, updates * count, updates * count * sizeof(derived4));
+	std::cout << "Reader walks: " << walks << ", torn versions: " << errors << std::endl;
+
+	// Single threaded costs //
+
+	time = Benchmark(5, [&]() {
+		const RcuContainer<std::vector<derived4>>::Snapshot snapshot = derived4_rcu.Read();
+		KeepAlive(Whole(MakeRange<const base>(snapshot)));
+	});
+	Report("RcuContainer Read and walk", time, count, count * sizeof(derived4));
+
+	time = Benchmark(5, [&]() {
+		KeepAlive(Whole(MakeRange<const base>(derived4_locked)));
+	});
+	Report("std::vector walk", time, count, count * sizeof(derived4));
+
+	if (!rcu_good) {
+		std::cout << "A reader saw a half written version" << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,459 @@
+/*!
+ * @file snapshot.h
+ * @author Saadiq Daniels
+ * @date 18/10/2026
+ * @version 1.0
+ * @brief
+ * 	Writes Iterator<const T> ranges to a file as sections of fixed size
+ * 	records through large reusable buffers and writev, and reads them back
+ * 	into containers with bulk reads. Needs a POSIX system.
+ */
+
+#ifndef TEMPL_ITERATOR_SNAPSHOT_H
+#define TEMPL_ITERATOR_SNAPSHOT_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <limits.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include "iterator.h"
+
+// The size of the buffer records are encoded into before they are written
+#ifndef ITERATOR_SNAPSHOT_BUFFER
+#define ITERATOR_SNAPSHOT_BUFFER (1 << 20)
+#endif
+
+// Packed runs of trivially copyable elements at least this many bytes long are
+// written straight from the container instead of being copied into the buffer
+#ifndef ITERATOR_SNAPSHOT_DIRECT
+#define ITERATOR_SNAPSHOT_DIRECT 4096
+#endif
+
+/*!
+ * @brief The header in front of every section of a snapshot
+ */
+struct SnapshotHeader
+{
+	// The number of records in the section
+	std::uint64_t count;
+	// The size of each record in bytes
+	std::uint64_t recordSize;
+};
+
+/*!
+ * @brief Writes sections of records to a snapshot file
+ * @details
+ *      Each call to Write adds one section. Records are encoded into a
+ *      buffer that is reused for every section, and the buffer is handed to
+ *      writev together with any runs of the container written in place, so
+ *      a std::vector of trivially copyable elements is written without
+ *      being copied at all.
+ */
+class SnapshotWriter
+{
+	// The file being written, or -1
+	int                       _file;
+	// Where the next byte goes in the file, counting what is still pending
+	std::uint64_t             _offset;
+	// Records waiting to be written
+	std::vector<char>         _buffer;
+	// The bytes of _buffer in use
+	std::size_t               _used;
+	// The start of the part of _buffer not yet in _pending
+	std::size_t               _mark;
+	// The pieces waiting for writev, from _buffer and from containers
+	std::vector<struct iovec> _pending;
+
+	/*!
+	 * @brief Adds the filled part of the buffer that is not pending yet to the pending pieces
+	 */
+	void Seal() {
+
+		if (_used != _mark) {
+			_pending.push_back({_buffer.data() + _mark, _used - _mark});
+			_mark = _used;
+		}
+	}
+
+	/*!
+	 * @brief Writes every pending piece and empties the buffer
+	 * @return True if everything was written
+	 */
+	bool Flush() {
+
+		Seal();
+		bool good = _file >= 0;
+		std::size_t first = 0;
+		while (good && first < _pending.size()) {
+			const int pieces = static_cast<int>(std::min<std::size_t>(_pending.size() - first, IOV_MAX));
+			ssize_t written = ::writev(_file, _pending.data() + first, pieces);
+			if (written < 0) {
+				good = false;
+				break;
+			}
+			// Skip the pieces that were written, and the written part of the one that was not finished
+			while (first < _pending.size() && static_cast<std::size_t>(written) >= _pending[first].iov_len) {
+				written -= static_cast<ssize_t>(_pending[first].iov_len);
+				++first;
+			}
+			if (first < _pending.size()) {
+				_pending[first].iov_base = static_cast<char *>(_pending[first].iov_base) + written;
+				_pending[first].iov_len -= static_cast<std::size_t>(written);
+			}
+		}
+		_pending.clear();
+		_used = 0;
+		_mark = 0;
+		if (!good) {
+			Close();
+		}
+		return good;
+	}
+
+	/*!
+	 * @brief Gets room for bytes in the buffer, flushing it when it is full
+	 * @param bytes The number of bytes needed, no more than the buffer size
+	 * @return Where to put the bytes, or nullptr if the file could not be written
+	 */
+	char *Room(std::size_t bytes) {
+
+		if (_used + bytes > _buffer.size() && !Flush()) {
+			return nullptr;
+		}
+		char *room = _buffer.data() + _used;
+		_used += bytes;
+		_offset += bytes;
+		return room;
+	}
+
+	/*!
+	 * @brief Adds a run of bytes to be written straight from where it is
+	 * @param data The bytes, which must not change until the next flush
+	 * @param bytes The number of bytes
+	 */
+	void Direct(const void *data, std::size_t bytes) {
+
+		Seal();
+		_pending.push_back({const_cast<void *>(data), bytes});
+		_offset += bytes;
+	}
+
+	/*!
+	 * @brief Fills in the header of a section once its records have been written
+	 * @param at Where the header is in the file
+	 * @param header The finished header
+	 * @return True if the header was written
+	 */
+	bool Patch(std::uint64_t at, const SnapshotHeader &header) {
+
+		if (!Flush()) {
+			return false;
+		}
+		if (::pwrite(_file, &header, sizeof(header), static_cast<off_t>(at)) != static_cast<ssize_t>(sizeof(header))) {
+			Close();
+			return false;
+		}
+		return true;
+	}
+
+public:
+
+	/*!
+	 * @brief Conversion constructor, creates or empties the file
+	 * @param path The file to write
+	 */
+	explicit SnapshotWriter(const std::string &path)
+			: _file(::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644)), _offset(0),
+			  _buffer(ITERATOR_SNAPSHOT_BUFFER), _used(0), _mark(0) {
+	}
+
+	/*!
+	 * @brief The file cannot be shared
+	 */
+	SnapshotWriter(const SnapshotWriter &) = delete;
+
+	/*!
+	 * @brief The file cannot be shared
+	 */
+	SnapshotWriter &operator=(const SnapshotWriter &) = delete;
+
+	/*!
+	 * @brief Destructor, closes the file
+	 */
+	~SnapshotWriter() {
+
+		Close();
+	}
+
+	/*!
+	 * @brief Checks if every write so far has worked
+	 * @return True if the file is open and nothing has failed
+	 */
+	bool Good() const noexcept(true) {
+
+		return _file >= 0;
+	}
+
+	/*!
+	 * @brief Closes the file, later writes fail
+	 */
+	void Close() noexcept(true) {
+
+		if (_file >= 0) {
+			::close(_file);
+			_file = -1;
+		}
+	}
+
+	/*!
+	 * @brief Writes a section with one record for every element of a range
+	 * @tparam T The base type (can be deduced)
+	 * @tparam F The encoder type (can be deduced)
+	 * @param range The elements to write
+	 * @param encode Takes a const T & and returns a trivially copyable record
+	 * @return The number of records written, check Good() for errors
+	 */
+	template<typename T, typename F>
+	std::uint64_t Write(const Range<const T> &range, F encode) {
+
+		using Record = std::decay_t<decltype(encode(std::declval<const T &>()))>;
+		static_assert(std::is_trivially_copyable<Record>::value, "Records are written as raw bytes");
+		static_assert(sizeof(Record) <= ITERATOR_SNAPSHOT_BUFFER, "A record must fit in the buffer");
+
+		const std::uint64_t at = _offset;
+		if (!Room(sizeof(SnapshotHeader))) {
+			return 0;
+		}
+		std::uint64_t count = 0;
+		bool good = true;
+		ForEachSegment(range, [&](const Span<const T> &segment) {
+			for (std::size_t i = 0; good && i < segment.count; ++i) {
+				const Record record = encode(segment[i]);
+				char *room = Room(sizeof(Record));
+				good = room != nullptr;
+				if (good) {
+					std::memcpy(room, &record, sizeof(Record));
+				}
+			}
+			count += good ? segment.count : 0;
+		});
+		return good && Patch(at, SnapshotHeader{count, sizeof(Record)}) ? count : 0;
+	}
+
+	/*!
+	 * @brief Writes a section with the elements of a range as they are in memory
+	 * @details
+	 *      Packed runs, such as a whole std::vector or a std::deque block,
+	 *      are written straight from the container
+	 * @tparam T The base type, which must be trivially copyable (can be deduced)
+	 * @param range The elements to write
+	 * @return The number of records written, check Good() for errors
+	 */
+	template<typename T>
+	std::uint64_t Write(const Range<const T> &range) {
+
+		static_assert(std::is_trivially_copyable<T>::value, "Elements are written as raw bytes");
+		static_assert(sizeof(T) <= ITERATOR_SNAPSHOT_BUFFER, "A record must fit in the buffer");
+
+		const std::uint64_t at = _offset;
+		if (!Room(sizeof(SnapshotHeader))) {
+			return 0;
+		}
+		std::uint64_t count = 0;
+		bool good = true;
+		ForEachSegment(range, [&](const Span<const T> &segment) {
+			if (!good) {
+				return;
+			}
+			if (segment.Packed() && segment.count * sizeof(T) >= ITERATOR_SNAPSHOT_DIRECT) {
+				Direct(segment.first, segment.count * sizeof(T));
+			} else {
+				for (std::size_t i = 0; good && i < segment.count; ++i) {
+					char *room = Room(sizeof(T));
+					good = room != nullptr;
+					if (good) {
+						std::memcpy(room, &segment[i], sizeof(T));
+					}
+				}
+			}
+			count += good ? segment.count : 0;
+		});
+		// The runs written in place are only valid until the range changes, so they go out now
+		return good && Patch(at, SnapshotHeader{count, sizeof(T)}) ? count : 0;
+	}
+};
+
+/*!
+ * @brief Reads the sections of a snapshot file back, in the order they were written
+ */
+class SnapshotReader
+{
+	// The file being read, or -1
+	int               _file;
+	// Records read but not yet handed out
+	std::vector<char> _buffer;
+
+	/*!
+	 * @brief Reads an exact number of bytes
+	 * @param out Where to put the bytes
+	 * @param bytes The number of bytes
+	 * @return True if all of them were read
+	 */
+	bool ReadAll(void *out, std::size_t bytes) {
+
+		char *at = static_cast<char *>(out);
+		while (_file >= 0 && bytes) {
+			const ssize_t got = ::read(_file, at, bytes);
+			if (got <= 0) {
+				Close();
+				return false;
+			}
+			at += got;
+			bytes -= static_cast<std::size_t>(got);
+		}
+		return _file >= 0;
+	}
+
+	/*!
+	 * @brief Reads the next section's header and checks its record size
+	 * @param recordSize The record size the caller expects
+	 * @param header The header that was read
+	 * @return True if a header with that record size was read
+	 */
+	bool Header(std::size_t recordSize, SnapshotHeader &header) {
+
+		if (!ReadAll(&header, sizeof(header))) {
+			return false;
+		}
+		if (header.recordSize != recordSize) {
+			Close();
+			return false;
+		}
+		return true;
+	}
+
+public:
+
+	/*!
+	 * @brief Conversion constructor, opens the file
+	 * @param path The file to read
+	 */
+	explicit SnapshotReader(const std::string &path)
+			: _file(::open(path.c_str(), O_RDONLY)), _buffer(ITERATOR_SNAPSHOT_BUFFER) {
+	}
+
+	/*!
+	 * @brief The file cannot be shared
+	 */
+	SnapshotReader(const SnapshotReader &) = delete;
+
+	/*!
+	 * @brief The file cannot be shared
+	 */
+	SnapshotReader &operator=(const SnapshotReader &) = delete;
+
+	/*!
+	 * @brief Destructor, closes the file
+	 */
+	~SnapshotReader() {
+
+		Close();
+	}
+
+	/*!
+	 * @brief Checks if every read so far has worked
+	 * @return True if the file is open and nothing has failed
+	 */
+	bool Good() const noexcept(true) {
+
+		return _file >= 0;
+	}
+
+	/*!
+	 * @brief Closes the file, later reads fail
+	 */
+	void Close() noexcept(true) {
+
+		if (_file >= 0) {
+			::close(_file);
+			_file = -1;
+		}
+	}
+
+	/*!
+	 * @brief Reads the next section straight into the end of a std::vector, with one read
+	 * @tparam Record The record type (can be deduced)
+	 * @param out The vector to add the records to
+	 * @return The number of records read, 0 if the section was missing or had
+	 * another record size
+	 */
+	template<typename Record>
+	std::uint64_t Read(std::vector<Record> &out) {
+
+		static_assert(std::is_trivially_copyable<Record>::value, "Records are read as raw bytes");
+		SnapshotHeader header{};
+		if (!Header(sizeof(Record), header)) {
+			return 0;
+		}
+		const std::size_t first = out.size();
+		out.resize(first + header.count);
+		if (!ReadAll(out.data() + first, header.count * sizeof(Record))) {
+			out.resize(first);
+			return 0;
+		}
+		return header.count;
+	}
+
+	/*!
+	 * @brief Reads the next section into a container, a buffer at a time
+	 * @details
+	 *      The container is reserved for the whole section first if it can
+	 *      be, then every record is passed to decode and the result is
+	 *      emplaced at the back
+	 * @tparam Record The record type (must be specified)
+	 * @tparam C The container type (can be deduced)
+	 * @tparam F The decoder type (can be deduced)
+	 * @param out The container to add the elements to
+	 * @param decode Takes a const Record & and returns what to emplace_back
+	 * @return The number of records read, 0 if the section was missing or had
+	 * another record size
+	 */
+	template<typename Record, typename C, typename F>
+	std::uint64_t Read(C &out, F decode) {
+
+		static_assert(std::is_trivially_copyable<Record>::value, "Records are read as raw bytes");
+		static_assert(sizeof(Record) <= ITERATOR_SNAPSHOT_BUFFER, "A record must fit in the buffer");
+		SnapshotHeader header{};
+		if (!Header(sizeof(Record), header)) {
+			return 0;
+		}
+		if constexpr(has_reserve<C>::value) {
+			out.reserve(out.size() + header.count);
+		}
+		const std::uint64_t perBuffer = _buffer.size() / sizeof(Record);
+		for (std::uint64_t left = header.count; left;) {
+			const std::uint64_t records = std::min(left, perBuffer);
+			if (!ReadAll(_buffer.data(), records * sizeof(Record))) {
+				return 0;
+			}
+			for (std::uint64_t i = 0; i < records; ++i) {
+				Record record;
+				std::memcpy(&record, _buffer.data() + i * sizeof(Record), sizeof(Record));
+				out.emplace_back(decode(record));
+			}
+			left -= records;
+		}
+		return header.count;
+	}
+};
+
+#endif //TEMPL_ITERATOR_SNAPSHOT_H
@@ -0,0 +1,138 @@
+/*!
+ * @file snapshot_driver.cpp
+ * @author Saadiq Daniels
+ * @date 18/10/2026
+ * @version 1.0
+ */
+
+#include <cstdio>
+#include <deque>
+#include <fstream>
+#include <iostream>
+#include <list>
+#include <string>
+#include <vector>
+
+#include "iterator.h"
+#include "snapshot.h"
+#include "base.h"
+#include "benchmark.h"
+
+/*!
+ * A trivially copyable component
+ */
+struct Transform
+{
+	float x, y, z, w;
+};
+
+/*!
+ * Tests checkpointing containers to a file through Iterator<const T> and reading them back
+ * @param argc The number of arguments
+ * @param argv The file to use, snapshot.bin by default
+ * @return 0, or 1 if what was read back does not match
+ */
+int main(int argc, char **argv) {
+
+	const std::string path = argc > 1 ? argv[1] : "snapshot.bin";
+
+	// Creating data //
+
+	const std::size_t count = 1 << 20;
+	std::vector<derived4> derived4_vector;
+	std::list<derived4> derived4_list;
+	std::vector<Transform> transform_vector;
+	std::deque<Transform> transform_deque;
+	derived4_vector.reserve(count);
+	transform_vector.reserve(count);
+	for (std::size_t i = 0; i < count; ++i) {
+		const auto number = static_cast<float>(i % 100);
+		derived4_vector.emplace_back(number);
+		derived4_list.emplace_back(number);
+		transform_vector.push_back({number, number + 1, number + 2, number + 3});
+		transform_deque.push_back({number, number + 1, number + 2, number + 3});
+	}
+	const Range<const base> vector_range = MakeRange<const base>(derived4_vector);
+	const Range<const base> list_range = MakeRange<const base>(derived4_list);
+	const Range<const Transform> transforms = MakeRange<const Transform>(transform_vector);
+	const Range<const Transform> transform_blocks = MakeRange<const Transform>(transform_deque);
+	const auto encode = [](const base &rhs) {
+		return rhs.getfloat();
+	};
+	const std::size_t bytes = count * (2 * sizeof(float) + 2 * sizeof(Transform));
+
+	// Benchmarking //
+
+	// One stream write per element, the way it used to be done
+	double time = Benchmark(3, [&]() {
+		std::ofstream file(path, std::ios::binary | std::ios::trunc);
+		for (const Range<const base> *range : {&vector_range, &list_range}) {
+			for (Iterator<const base> it = range->begin(), end = range->end(); it != end; ++it) {
+				const float number = it->getfloat();
+				file.write(reinterpret_cast<const char *>(&number), sizeof(number));
+			}
+		}
+		for (const Range<const Transform> *range : {&transforms, &transform_blocks}) {
+			for (Iterator<const Transform> it = range->begin(), end = range->end(); it != end; ++it) {
+				file.write(reinterpret_cast<const char *>(&it->x), sizeof(float));
+				file.write(reinterpret_cast<const char *>(&it->y), sizeof(float));
+				file.write(reinterpret_cast<const char *>(&it->z), sizeof(float));
+				file.write(reinterpret_cast<const char *>(&it->w), sizeof(float));
+			}
+		}
+	});
+	Report("ofstream per field", time, count * 4, bytes);
+
+	bool good = true;
+	time = Benchmark(3, [&]() {
+		SnapshotWriter writer(path);
+		writer.Write(vector_range, encode);
+		writer.Write(list_range, encode);
+		writer.Write(transforms);
+		writer.Write(transform_blocks);
+		good = good && writer.Good();
+	});
+	Report("SnapshotWriter", time, count * 4, bytes);
+
+	std::vector<derived4> loaded_vector;
+	std::list<derived4> loaded_list;
+	std::vector<Transform> loaded_transforms;
+	std::deque<Transform> loaded_blocks;
+	time = Benchmark(3, [&]() {
+		loaded_vector.clear();
+		loaded_list.clear();
+		loaded_transforms.clear();
+		loaded_blocks.clear();
+		SnapshotReader reader(path);
+		reader.Read<float>(loaded_vector, [](float number) {
+			return number;
+		});
+		reader.Read<float>(loaded_list, [](float number) {
+			return number;
+		});
+		reader.Read(loaded_transforms);
+		reader.Read<Transform>(loaded_blocks, [](const Transform &rhs) {
+			return rhs;
+		});
+		good = good && reader.Good();
+	});
+	Report("SnapshotReader", time, count * 4, bytes);
+
+	// Checking //
+
+	good = good && loaded_vector.size() == count && loaded_list.size() == count &&
+	       loaded_transforms.size() == count && loaded_blocks.size() == count;
+	auto list_it = loaded_list.begin();
+	for (std::size_t i = 0; good && i < count; ++i, ++list_it) {
+		good = loaded_vector[i].getfloat() == derived4_vector[i].getfloat() &&
+		       list_it->getfloat() == derived4_vector[i].getfloat() &&
+		       loaded_transforms[i].w == transform_vector[i].w && loaded_blocks[i].x == transform_deque[i].x;
+	}
+	std::remove(path.c_str());
+	if (!good) {
+		std::cout << "Snapshot does not match" << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,194 @@
+/*!
+ * @file soa_driver.cpp
+ * @author Saadiq Daniels
+ * @date 18/10/2026
+ * @version 1.0
+ */
+
+#include <algorithm>
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+#include "iterator.h"
+#include "soa_vector.h"
+#include "base.h"
+#include "benchmark.h"
+
+class derived1_view;
+
+// Column 0 is the base id, column 1 is the float derived1 would hold
+using derived1_soa = SoAVector<derived1_view, int, float>;
+
+/*!
+ * Stands in for a derived1 stored as a row of a derived1_soa
+ */
+class derived1_view : public base
+{
+	/*!
+	 * The container holding the row
+	 */
+	derived1_soa *_owner;
+	/*!
+	 * The row being viewed
+	 */
+	std::size_t _index;
+public:
+	/*!
+	 * Builds a view of one row
+	 * @param owner The container holding the row
+	 * @param index The row to view
+	 */
+	derived1_view(derived1_soa &owner, std::size_t index)
+			: base(owner.Column<0>()[index]), _owner(&owner), _index(index) {
+	}
+
+	/*!
+	 * Gets the float stored in the row
+	 * @return The float column of the row
+	 */
+	float getfloat() const override {
+
+		return _owner->Column<1>()[_index];
+	}
+
+	/*!
+	 * Does nothing
+	 */
+	void doNothing() override {
+
+		std::cout << "Derived 1 View Do Nothing" << std::endl;
+	}
+
+	/*!
+	 * Does nothing (const)
+	 */
+	void doSomething() const override {
+
+		std::cout << "Derived 1 View Do Something" << std::endl;
+	}
+};
+
+/*!
+ * Tests a structure-of-arrays container through Iterator<base> and
+ * compares streaming its columns against a std::vector<derived1>
+ * @return 0
+ */
+int main() {
+
+	// Creating data //
+
+	const int count = 1 << 20;
+	std::vector<derived1> derived1_vector;
+	derived1_soa derived1_columns;
+	derived1_vector.reserve(count);
+	derived1_columns.reserve(count);
+	for (int i = 0; i < count; ++i) {
+		derived1_vector.emplace_back(static_cast<float>(i % 100));
+		derived1_columns.emplace_back(derived1_vector.back().getInt(), static_cast<float>(i % 100));
+	}
+
+	// Printing the first few rows through Iterator<base> //
+	Iterator<base> soa_begin = MakeIterator<base>(derived1_columns.begin());
+	Iterator<base> soa_end = MakeIterator<base>(derived1_columns.end());
+
+	std::cout << "Derived1_SoA:" << std::endl;
+	Iterator<base> soa_it(soa_begin);
+	for (int i = 0; i < 10 && soa_it != soa_end; ++i, ++soa_it) {
+		std::cout << "(" << soa_it->getInt() << ", " << (*soa_it).getfloat() << ")\t";
+	}
+	std::cout << std::endl;
+
+	// Benchmarking //
+
+	Iterator<base> vector_begin = MakeIterator<base>(derived1_vector.begin());
+	Iterator<base> vector_end = MakeIterator<base>(derived1_vector.end());
+	const double object_bytes = static_cast<double>(count) * sizeof(derived1);
+	const double column_bytes = static_cast<double>(count) * sizeof(float);
+	float sums[4] = {};
+
+	double time = Benchmark(10, [&]() {
+		float sum = 0.f;
+		for (Iterator<base> it(vector_begin); it != vector_end; ++it) {
+			sum += it->getfloat();
+		}
+		sums[0] = sum;
+	});
+	Report("vector<derived1> Iterator<base> loop", time, count, object_bytes);
+
+	time = Benchmark(10, [&]() {
+		float sum = 0.f;
+		ForEach(vector_begin, vector_end, [&sum](const base &rhs) {
+			sum += rhs.getfloat();
+		});
+		sums[1] = sum;
+	});
+	Report("vector<derived1> ForEach", time, count, object_bytes);
+
+	time = Benchmark(10, [&]() {
+		float sum = 0.f;
+		ForEach(soa_begin, soa_end, [&sum](const base &rhs) {
+			sum += rhs.getfloat();
+		});
+		sums[2] = sum;
+	});
+	Report("SoA ForEach through views", time, count, column_bytes);
+
+	time = Benchmark(10, [&]() {
+		float sum = 0.f;
+		derived1_columns.ForEach([&sum](int, float number) {
+			sum += number;
+		});
+		sums[3] = sum;
+	});
+	Report("SoA column stream", time, count, column_bytes);
+
+	// Scan hands each row's View to the callback by value
+	float scanned = 0.f;
+	bool rows = true;
+	soa_begin.Scan(soa_end, [&](base &rhs, std::size_t distance) {
+		scanned += rhs.getfloat();
+		rows = rows && rhs.getInt() == derived1_columns.Column<0>()[distance];
+		return true;
+	});
+
+	// min_element and max_element must not hold on to a View between rows
+	derived1_soa small_columns;
+	const float small_values[] = {5.f, 1.f, 9.f, 3.f, 7.f};
+	for (int i = 0; i < 5; ++i) {
+		small_columns.emplace_back(i, small_values[i]);
+	}
+	const Iterator<base> small_begin = MakeIterator<base>(small_columns.begin());
+	const Iterator<base> small_end = MakeIterator<base>(small_columns.end());
+	auto by_float = [](const base &lhs, const base &rhs) {
+		return lhs.getfloat() < rhs.getfloat();
+	};
+	const float smallest = min_element(small_begin, small_end, by_float)->getfloat();
+	const float largest = max_element(small_begin, small_end, by_float)->getfloat();
+	std::cout << "SoA min_element " << smallest << ", max_element " << largest << std::endl;
+
+	// Standard algorithms that dispatch on the random access tag //
+	const auto found = std::lower_bound(small_columns.begin(), small_columns.end(), 3,
+	                                    [](const derived1_view &row, int id) {
+		return row.getInt() < id;
+	});
+	const bool random_access = found - small_columns.begin() == 3 && found[-1].getfloat() == 9.f &&
+	                           (small_columns.begin() + 4)->getfloat() == 7.f &&
+	                           small_columns.begin() < found && std::prev(small_columns.end()) >= found;
+
+	KeepAlive(sums[0] + sums[1] + sums[2] + sums[3]);
+	if (!random_access) {
+		std::cout << "Random access operators do not agree" << std::endl;
+		return 1;
+	}
+	if (smallest != 1.f || largest != 9.f) {
+		std::cout << "Wrong min_element or max_element" << std::endl;
+		return 1;
+	}
+	if (sums[0] != sums[1] || sums[0] != sums[2] || sums[0] != sums[3] || sums[0] != scanned || !rows) {
+		std::cout << "Sums do not match" << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,563 @@
+/*!
+ * @file soa_vector.h
+ * @author Saadiq Daniels
+ * @date 18/10/2026
+ * @version 1.0
+ * @brief
+ * 	A structure-of-arrays container, which keeps every field of its elements
+ * 	in its own contiguous column, and the iterator wrapper that lets it be
+ * 	used through an Iterator<T> like any other container
+ */
+
+#ifndef TEMPL_ITERATOR_SOA_VECTOR_H
+#define TEMPL_ITERATOR_SOA_VECTOR_H
+
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "iterator.h"
+
+template<typename View, typename... Columns>
+class SoAVector;
+
+/*!
+ * @brief The iterator for a SoAVector
+ * @details
+ *      There is no object in memory for an element of a SoAVector, so
+ *      dereferencing this iterator builds a View of the current row and
+ *      keeps it inside the iterator. The reference is good until the
+ *      iterator is dereferenced or moved again.
+ * @tparam View The type that stands in for one row, constructed from
+ * (SoAVector &, std::size_t)
+ * @tparam Columns The types of the columns
+ */
+template<typename View, typename... Columns>
+class SoAIterator
+{
+public:
+	// User friendly names for data types
+	using iterator_category = std::random_access_iterator_tag;
+	using value_type = View;
+	using difference_type = long;
+	using pointer = View *;
+	using reference = View &;
+	using container_type = SoAVector<View, Columns...>;
+
+private:
+	// The container being iterated over
+	container_type *_owner;
+	// The row this iterator is pointing at
+	std::size_t _index;
+	// The last View built by the dereference operator
+	mutable std::optional<View> _view;
+
+public:
+
+	/*!
+	 * @brief Conversion constructor
+	 * @param owner The container to iterate over
+	 * @param index The row to point at
+	 */
+	SoAIterator(container_type &owner, std::size_t index) noexcept(true) : _owner(&owner), _index(index) {
+	}
+
+	/*!
+	 * @brief Copy constructor, the cached View is not copied
+	 * @param rhs The iterator to copy
+	 */
+	SoAIterator(const SoAIterator &rhs) noexcept(true) : _owner(rhs._owner), _index(rhs._index) {
+	}
+
+	/*!
+	 * @brief Assignment operator, the cached View is not copied
+	 * @param rhs The iterator to copy
+	 * @return A reference to this iterator
+	 */
+	SoAIterator &operator=(const SoAIterator &rhs) noexcept(true) {
+
+		_owner = rhs._owner;
+		_index = rhs._index;
+		_view.reset();
+		return *this;
+	}
+
+	/*!
+	 * @brief Dereference operator, builds a View of the current row
+	 * @return A reference to the View
+	 */
+	reference operator*() const {
+
+		_view.emplace(*_owner, _index);
+		return *_view;
+	}
+
+	/*!
+	 * @brief Arrow operator, builds a View of the current row
+	 * @return A pointer to the View
+	 */
+	pointer operator->() const {
+
+		return &**this;
+	}
+
+	/*!
+	 * @brief Increment operator
+	 * @return A reference to this iterator
+	 */
+	SoAIterator &operator++() noexcept(true) {
+
+		++_index;
+		return *this;
+	}
+
+	/*!
+	 * @brief Post increment operator
+	 * @return A copy of this iterator from before the increment
+	 */
+	SoAIterator operator++(int) noexcept(true) {
+
+		SoAIterator copy(*this);
+		++_index;
+		return copy;
+	}
+
+	/*!
+	 * @brief Decrement operator
+	 * @return A reference to this iterator
+	 */
+	SoAIterator &operator--() noexcept(true) {
+
+		--_index;
+		return *this;
+	}
+
+	/*!
+	 * @brief Post decrement operator
+	 * @return A copy of this iterator from before the decrement
+	 */
+	SoAIterator operator--(int) noexcept(true) {
+
+		SoAIterator copy(*this);
+		--_index;
+		return copy;
+	}
+
+	/*!
+	 * @brief Moves the iterator by more than one row
+	 * @param count The number of rows to move forward
+	 * @return A reference to this iterator
+	 */
+	SoAIterator &operator+=(difference_type count) noexcept(true) {
+
+		_index += count;
+		return *this;
+	}
+
+	/*!
+	 * @brief Moves the iterator back by more than one row
+	 * @param count The number of rows to move back
+	 * @return A reference to this iterator
+	 */
+	SoAIterator &operator-=(difference_type count) noexcept(true) {
+
+		_index -= count;
+		return *this;
+	}
+
+	/*!
+	 * @brief Addition operator
+	 * @param count The number of rows to move forward
+	 * @return A new iterator count rows after this one
+	 */
+	SoAIterator operator+(difference_type count) const noexcept(true) {
+
+		return SoAIterator(*_owner, _index + count);
+	}
+
+	/*!
+	 * @brief Addition operator, with the count first
+	 * @param count The number of rows to move forward
+	 * @param rhs The iterator to start from
+	 * @return A new iterator count rows after rhs
+	 */
+	friend SoAIterator operator+(difference_type count, const SoAIterator &rhs) noexcept(true) {
+
+		return rhs + count;
+	}
+
+	/*!
+	 * @brief Subtraction operator
+	 * @param count The number of rows to move back
+	 * @return A new iterator count rows before this one
+	 */
+	SoAIterator operator-(difference_type count) const noexcept(true) {
+
+		return SoAIterator(*_owner, _index - count);
+	}
+
+	/*!
+	 * @brief Subtraction operator
+	 * @param rhs The iterator to find the distance from
+	 * @return The number of rows between the two iterators
+	 */
+	difference_type operator-(const SoAIterator &rhs) const noexcept(true) {
+
+		return static_cast<difference_type>(_index) - static_cast<difference_type>(rhs._index);
+	}
+
+	/*!
+	 * @brief Subscript operator, builds a View of the row count rows on
+	 * @details
+	 *      The View is kept in this iterator, like the one from operator*
+	 * @param count The number of rows on from this one
+	 * @return A reference to the View
+	 */
+	reference operator[](difference_type count) const {
+
+		_view.emplace(*_owner, _index + count);
+		return *_view;
+	}
+
+	/*!
+	 * @brief Less than operator
+	 * @param rhs The iterator to compare with
+	 * @return True if this iterator points at an earlier row
+	 */
+	bool operator<(const SoAIterator &rhs) const noexcept(true) {
+
+		return _index < rhs._index;
+	}
+
+	/*!
+	 * @brief Greater than operator
+	 * @param rhs The iterator to compare with
+	 * @return True if this iterator points at a later row
+	 */
+	bool operator>(const SoAIterator &rhs) const noexcept(true) {
+
+		return rhs < *this;
+	}
+
+	/*!
+	 * @brief Less than or equal operator
+	 * @param rhs The iterator to compare with
+	 * @return True if this iterator points at the same or an earlier row
+	 */
+	bool operator<=(const SoAIterator &rhs) const noexcept(true) {
+
+		return !(rhs < *this);
+	}
+
+	/*!
+	 * @brief Greater than or equal operator
+	 * @param rhs The iterator to compare with
+	 * @return True if this iterator points at the same or a later row
+	 */
+	bool operator>=(const SoAIterator &rhs) const noexcept(true) {
+
+		return !(*this < rhs);
+	}
+
+	/*!
+	 * @brief Equality operator
+	 * @param rhs The iterator to compare with
+	 * @return True if both iterators point at the same row
+	 */
+	bool operator==(const SoAIterator &rhs) const noexcept(true) {
+
+		return _index == rhs._index && _owner == rhs._owner;
+	}
+
+	/*!
+	 * @brief Inequality operator
+	 * @param rhs The iterator to compare with
+	 * @return False if both iterators point at the same row
+	 */
+	bool operator!=(const SoAIterator &rhs) const noexcept(true) {
+
+		return !(*this == rhs);
+	}
+
+	/*!
+	 * @brief Gets the container this iterator walks over
+	 * @return The container
+	 */
+	container_type &Owner() const noexcept(true) {
+
+		return *_owner;
+	}
+
+	/*!
+	 * @brief Gets the row this iterator points at
+	 * @return The row index
+	 */
+	std::size_t Index() const noexcept(true) {
+
+		return _index;
+	}
+};
+
+/*!
+ * @brief A container that stores each field in its own std::vector
+ * @details
+ *      Loops that only touch one or two fields can stream through the
+ *      columns directly with ForEach or Column, which only pulls the bytes
+ *      they need into cache and lets the compiler vectorise the loop.
+ *      Code that needs a base class reference goes through begin and end,
+ *      which build a View for each row.
+ * @tparam View The type that stands in for one row. It is usually derived from
+ * the base class and is constructed from (SoAVector &, std::size_t)
+ * @tparam Columns The types of the columns
+ */
+template<typename View, typename... Columns>
+class SoAVector
+{
+public:
+	// User friendly names for data types
+	using value_type = View;
+	using size_type = std::size_t;
+	using iterator = SoAIterator<View, Columns...>;
+
+private:
+	// One vector for every column
+	std::tuple<std::vector<Columns>...> _columns;
+
+	/*!
+	 * @brief Pushes one field onto the back of every column
+	 */
+	template<typename... Args, std::size_t... I>
+	void EmplaceBack(std::index_sequence<I...>, Args &&... fields) {
+
+		(std::get<I>(_columns).emplace_back(std::forward<Args>(fields)), ...);
+	}
+
+	/*!
+	 * @brief Calls a function with the fields of every row
+	 */
+	template<typename F, std::size_t... I>
+	void ForEach(std::index_sequence<I...>, F &function) {
+
+		const std::size_t rows = size();
+		// Pull the column pointers out of the tuple so the loop
+		// only works with plain arrays
+		auto columns = std::make_tuple(std::get<I>(_columns).data()...);
+		for (std::size_t i = 0; i < rows; ++i) {
+			function(std::get<I>(columns)[i]...);
+		}
+	}
+
+public:
+
+	/*!
+	 * @brief Adds a row to the back of the container
+	 * @param fields One value for every column, in column order
+	 */
+	template<typename... Args>
+	void emplace_back(Args &&... fields) {
+
+		static_assert(sizeof...(Args) == sizeof...(Columns), "Every column needs a value");
+		EmplaceBack(std::index_sequence_for<Columns...>(), std::forward<Args>(fields)...);
+	}
+
+	/*!
+	 * @brief Reserves space in every column
+	 * @param rows The number of rows to make room for
+	 */
+	void reserve(size_type rows) {
+
+		std::apply([rows](auto &... column) { (column.reserve(rows), ...); }, _columns);
+	}
+
+	/*!
+	 * @brief Removes every row
+	 */
+	void clear() noexcept(true) {
+
+		std::apply([](auto &... column) { (column.clear(), ...); }, _columns);
+	}
+
+	/*!
+	 * @brief Gets the number of rows
+	 * @return The number of rows
+	 */
+	size_type size() const noexcept(true) {
+
+		return std::get<0>(_columns).size();
+	}
+
+	/*!
+	 * @brief Gets a column
+	 * @tparam I The index of the column
+	 * @return The vector holding that column
+	 */
+	template<std::size_t I>
+	auto &Column() noexcept(true) {
+
+		return std::get<I>(_columns);
+	}
+
+	/*!
+	 * @brief Gets a column, const
+	 * @tparam I The index of the column
+	 * @return The vector holding that column
+	 */
+	template<std::size_t I>
+	const auto &Column() const noexcept(true) {
+
+		return std::get<I>(_columns);
+	}
+
+	/*!
+	 * @brief Calls a function with references to the fields of every row
+	 * @tparam F The function type (can be deduced)
+	 * @param function Called once per row with one reference per column
+	 * @return The function, after it has visited every row
+	 */
+	template<typename F>
+	F ForEach(F function) {
+
+		ForEach(std::index_sequence_for<Columns...>(), function);
+		return function;
+	}
+
+	/*!
+	 * @brief Builds a View of one row, for code that needs the base class
+	 * @param index The row to view
+	 * @return The View
+	 */
+	View operator[](size_type index) {
+
+		return View(*this, index);
+	}
+
+	/*!
+	 * @brief Gets an iterator to the first row
+	 * @return An iterator to the first row
+	 */
+	iterator begin() noexcept(true) {
+
+		return iterator(*this, 0);
+	}
+
+	/*!
+	 * @brief Gets an iterator past the last row
+	 * @return An iterator past the last row
+	 */
+	iterator end() noexcept(true) {
+
+		return iterator(*this, size());
+	}
+};
+
+/*!
+ * @brief The iterator wrapper for SoAIterators
+ * @details
+ *      The plain IteratorWrapper would hand out the same cached View for
+ *      every element of a batch, so this keeps one View for each element
+ *      of the last batch instead. Room for ITERATOR_BATCH_SIZE Views is
+ *      reserved when the wrapper is made, so Batch never allocates.
+ * @tparam T The base class type
+ * @tparam U The SoAIterator type
+ */
+template<typename T, typename U>
+class IteratorWrapperSoA : public IteratorWrapper<T, U>
+{
+	typedef typename make_const<U>::type CU;
+	typedef typename make_mutable<U>::type::value_type View;
+	typedef typename IteratorWrapper<T, U>::mutable_derived_type mutable_derived_type;
+
+	// The Views handed out by the last call to Batch
+	std::vector<View> _views;
+
+public:
+
+	/*!
+	 * @brief Conversion constructor, takes an iterator
+	 * @param iterator The iterator to store internally
+	 */
+	explicit IteratorWrapperSoA(CU &iterator) : IteratorWrapper<T, U>(iterator) {
+
+		_views.reserve(ITERATOR_BATCH_SIZE);
+	}
+
+	/*!
+	 * @brief Default destructor
+	 */
+	virtual ~IteratorWrapperSoA() noexcept(true) = default;
+
+	/*!
+	 * @brief Batched increment, builds a View for each of up to count rows and
+	 * writes their addresses into out
+	 * @details
+	 *      The Views stay valid until the next call to Batch. At most
+	 *      ITERATOR_BATCH_SIZE rows are handed out per call.
+	 * @param out The array to write the element addresses into
+	 * @param count The size of the out array
+	 * @param end The iterator to stop at
+	 * @return The number of addresses written
+	 */
+	virtual std::size_t Batch(T **out, std::size_t count, const Iterator<T> &end) noexcept(true) {
+
+		_views.clear();
+		if (count > ITERATOR_BATCH_SIZE) {
+			count = ITERATOR_BATCH_SIZE;
+		}
+		return IteratorWrapper<T, U>::BatchOf(out, count, end, [this](const U &iterator) {
+			_views.emplace_back(iterator.Owner(), iterator.Index());
+			return &_views.back();
+		});
+	}
+
+	/*!
+	 * @brief Walks from this iterator to end, building a View for each row
+	 * @details
+	 *      Each View only lives for its own call to visit, so visit must not
+	 *      keep its address
+	 * @param end The iterator to stop at
+	 * @param visit Called with each row's View and its distance from this
+	 * iterator, the walk stops when it returns false
+	 * @return The distance to the row the walk stopped at, or to end
+	 */
+	virtual std::size_t Scan(const Iterator<T> &end, FunctionRef<bool(T &, std::size_t)> visit) const {
+
+		const mutable_derived_type &last = reinterpret_cast<const IteratorWrapperSoA<T, U> &>(end)._it;
+		mutable_derived_type it(IteratorWrapper<T, U>::_it);
+		std::size_t distance = 0;
+		for (; it != last; ++it, ++distance) {
+			View view(it.Owner(), it.Index());
+			if (!visit(view, distance)) {
+				break;
+			}
+		}
+		return distance;
+	}
+
+	/*!
+	 * @brief Copies this iterator
+	 * @return A new, identical iterator
+	 */
+	virtual Iterator<T> *Copy() const noexcept(true) {
+
+		return new IteratorWrapperSoA(IteratorWrapper<T, U>::_it);
+	}
+};
+
+/*!
+ * @brief Creates an iterator over a SoAVector
+ * @tparam T The base type (must be specified)
+ * @tparam View The View type (can be deduced)
+ * @tparam Columns The column types (can be deduced)
+ * @param iterator The iterator to store internally
+ * @return A new iterator
+ */
+template<typename T, typename View, typename... Columns>
+Iterator<T> MakeIterator(const SoAIterator<View, Columns...> &iterator) {
+
+	return static_cast<Iterator<T>>(*new IteratorWrapperSoA<T, SoAIterator<View, Columns...>>(iterator));
+}
+
+#endif //TEMPL_ITERATOR_SOA_VECTOR_H
@@ -0,0 +1,108 @@
+/*!
+ * @file sparse_driver.cpp
+ * @author Saadiq Daniels
+ * @date 18/10/2026
+ * @version 1.0
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "iterator.h"
+#include "sparse_set.h"
+#include "base.h"
+#include "benchmark.h"
+
+/*!
+ * Tests replacing a hash table of components with a SparseSet behind the same Iterator<base>
+ * @return 0, or 1 if the containers do not agree
+ */
+int main() {
+
+	// Creating data //
+
+	const std::size_t count = 1 << 20;
+	std::vector<std::size_t> ids(count);
+	for (std::size_t i = 0; i < count; ++i) {
+		ids[i] = i;
+	}
+	std::mt19937 random(11);
+	std::shuffle(ids.begin(), ids.end(), random);
+
+	std::unordered_map<std::size_t, derived4> derived4_hash;
+	SparseSet<derived4> derived4_sparse;
+	derived4_hash.reserve(count);
+	derived4_sparse.reserve(count);
+	for (std::size_t id : ids) {
+		derived4_hash.emplace(id, derived4(static_cast<float>(id % 100)));
+		derived4_sparse.emplace(id, static_cast<float>(id % 100));
+	}
+	// Removing every third entity leaves holes for the sparse set to fill by swapping
+	for (std::size_t id = 0; id < count; id += 3) {
+		derived4_hash.erase(id);
+		derived4_sparse.erase(id);
+	}
+	const std::size_t size = derived4_sparse.size();
+	std::cout << "Derived4_Sparse: " << size << " components, " << derived4_hash.size() << " in the hash table"
+	          << std::endl;
+
+	// Both containers look the same from here on //
+	const KeyedRange<base, std::size_t> hash_range = MakeKeyedRangeRight<base>(derived4_hash);
+	const KeyedRange<base, std::size_t> sparse_range = MakeKeyedRangeSparse<base>(derived4_sparse);
+
+	// Benchmarking //
+
+	double sums[2] = {};
+	const KeyedRange<base, std::size_t> *ranges[] = {&hash_range, &sparse_range};
+	const char *names[] = {"unordered_map", "SparseSet"};
+
+	for (int c = 0; c < 2; ++c) {
+		const Range<base> &range = ranges[c]->All();
+		const double time = Benchmark(5, [&]() {
+			double sum = 0.0;
+			ForEach(range, [&sum](const base &rhs) {
+				sum += rhs.getfloat();
+			});
+			sums[c] = sum;
+		});
+		Report(std::string(names[c]) + " ForEach", time, size, size * sizeof(derived4));
+	}
+
+	// Random ids, a third of which have been removed
+	const std::size_t lookups = 100000;
+	std::vector<std::size_t> keys(lookups);
+	for (std::size_t &key : keys) {
+		key = random() % count;
+	}
+	std::size_t hits[2] = {};
+	for (int c = 0; c < 2; ++c) {
+		const KeyedRange<base, std::size_t> &range = *ranges[c];
+		const double time = Benchmark(5, [&]() {
+			std::size_t found = 0;
+			for (std::size_t key : keys) {
+				found += range.Contains(key);
+			}
+			hits[c] = found;
+		});
+		Report(std::string(names[c]) + " Find", time, lookups, 0);
+	}
+
+	KeepAlive(sums[0] + sums[1]);
+	bool same = sums[0] == sums[1] && hits[0] == hits[1] && derived4_hash.size() == size;
+	for (std::size_t key : keys) {
+		Iterator<base> found = sparse_range.Find(key);
+		auto expected = derived4_hash.find(key);
+		same = same && (expected == derived4_hash.end() ? found == sparse_range.end()
+		                                                : found->getfloat() == expected->second.getfloat());
+	}
+	if (!same) {
+		std::cout << "Containers do not match" << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,313 @@
+/*!
+ * @file sparse_set.h
+ * @author Saadiq Daniels
+ * @date 18/10/2026
+ * @version 1.0
+ * @brief
+ * 	A container of components keyed by integer id, which keeps the
+ * 	components packed in a vector and finds them by id in constant time
+ */
+
+#ifndef TEMPL_ITERATOR_SPARSE_SET_H
+#define TEMPL_ITERATOR_SPARSE_SET_H
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "iterator.h"
+#include "iterator_keyed.h"
+
+/*!
+ * @brief Stores components packed together, with a table from id to position
+ * @details
+ *      begin and end are the std::vector's own iterators, so MakeRange<T>
+ *      takes the same contiguous fast path as a std::vector< derived >.
+ *      Erasing moves the last component into the hole, so the order of the
+ *      components changes and iterators and pointers are invalidated by
+ *      emplace and erase. The id table has one entry per id up to the
+ *      largest one used, so ids should be small and dense, such as entity
+ *      indices.
+ * @tparam V The component type
+ * @tparam Id The id type, an unsigned integer
+ */
+template<typename V, typename Id = std::size_t>
+class SparseSet
+{
+	static_assert(std::is_integral<Id>::value && std::is_unsigned<Id>::value, "Ids must be unsigned integers");
+
+public:
+	// User friendly names for data types
+	using value_type = V;
+	using key_type = Id;
+	using size_type = std::size_t;
+	using iterator = typename std::vector<V>::iterator;
+	using const_iterator = typename std::vector<V>::const_iterator;
+
+private:
+	// Marks an id with no component in the id table
+	static constexpr size_type npos = static_cast<size_type>(-1);
+
+	// The components, packed together
+	std::vector<V>         _dense;
+	// The id of each component, in the same order
+	std::vector<Id>        _ids;
+	// The position of each id's component, or npos
+	std::vector<size_type> _sparse;
+
+public:
+
+	/*!
+	 * @brief Adds a component, or replaces the one an id already has
+	 * @tparam Args The constructor argument types (can be deduced)
+	 * @param id The id of the component
+	 * @param args The arguments to construct the component with
+	 * @return A reference to the component
+	 */
+	template<typename... Args>
+	V &emplace(key_type id, Args &&... args) {
+
+		if (id >= _sparse.size()) {
+			_sparse.resize(static_cast<size_type>(id) + 1, npos);
+		}
+		const size_type index = _sparse[id];
+		if (index != npos) {
+			_dense[index] = V(std::forward<Args>(args)...);
+			return _dense[index];
+		}
+		_dense.emplace_back(std::forward<Args>(args)...);
+		_ids.push_back(id);
+		_sparse[id] = _dense.size() - 1;
+		return _dense.back();
+	}
+
+	/*!
+	 * @brief Removes an id's component by moving the last component into its place
+	 * @param id The id of the component
+	 * @return True if there was a component to remove
+	 */
+	bool erase(key_type id) {
+
+		if (!contains(id)) {
+			return false;
+		}
+		const size_type index = _sparse[id];
+		const size_type last = _dense.size() - 1;
+		if (index != last) {
+			_dense[index] = std::move(_dense[last]);
+			_ids[index] = _ids[last];
+			_sparse[_ids[index]] = index;
+		}
+		_dense.pop_back();
+		_ids.pop_back();
+		_sparse[id] = npos;
+		return true;
+	}
+
+	/*!
+	 * @brief Checks if an id has a component
+	 * @param id The id to look for
+	 * @return True if the id has a component
+	 */
+	bool contains(key_type id) const noexcept(true) {
+
+		return id < _sparse.size() && _sparse[id] != npos;
+	}
+
+	/*!
+	 * @brief Looks up an id's component in constant time
+	 * @param id The id to look for
+	 * @return An iterator to the component, or end()
+	 */
+	iterator find(key_type id) noexcept(true) {
+
+		return contains(id) ? _dense.begin() + _sparse[id] : _dense.end();
+	}
+
+	/*!
+	 * @brief Looks up an id's component in constant time
+	 * @param id The id to look for
+	 * @return An iterator to the component, or end()
+	 */
+	const_iterator find(key_type id) const noexcept(true) {
+
+		return contains(id) ? _dense.cbegin() + _sparse[id] : _dense.cend();
+	}
+
+	/*!
+	 * @brief Gets the id of the component at a position
+	 * @param index The position of the component
+	 * @return The component's id
+	 */
+	key_type IdAt(size_type index) const noexcept(true) {
+
+		return _ids[index];
+	}
+
+	/*!
+	 * @brief Reserves room for components
+	 * @param count The number of components
+	 */
+	void reserve(size_type count) {
+
+		_dense.reserve(count);
+		_ids.reserve(count);
+	}
+
+	/*!
+	 * @brief Removes every component, keeping the id table's memory
+	 */
+	void clear() noexcept(true) {
+
+		for (key_type id : _ids) {
+			_sparse[id] = npos;
+		}
+		_dense.clear();
+		_ids.clear();
+	}
+
+	/*!
+	 * @brief Gets the number of components
+	 * @return The number of components
+	 */
+	size_type size() const noexcept(true) {
+
+		return _dense.size();
+	}
+
+	/*!
+	 * @brief Checks if there are no components
+	 * @return True if there are no components
+	 */
+	bool empty() const noexcept(true) {
+
+		return _dense.empty();
+	}
+
+	/*!
+	 * @brief Gets the first component
+	 * @return An iterator to the first component
+	 */
+	iterator begin() noexcept(true) {
+
+		return _dense.begin();
+	}
+
+	/*!
+	 * @brief Gets the end of the components
+	 * @return An iterator past the last component
+	 */
+	iterator end() noexcept(true) {
+
+		return _dense.end();
+	}
+
+	/*!
+	 * @brief Gets the first component
+	 * @return An iterator to the first component
+	 */
+	const_iterator begin() const noexcept(true) {
+
+		return _dense.begin();
+	}
+
+	/*!
+	 * @brief Gets the end of the components
+	 * @return An iterator past the last component
+	 */
+	const_iterator end() const noexcept(true) {
+
+		return _dense.end();
+	}
+};
+
+/*!
+ * @brief KeyedIndex for a SparseSet
+ * @tparam T The base type
+ * @tparam C The SparseSet type
+ */
+template<typename T, typename C>
+class KeyedIndexSparse : public KeyedIndex<T, typename C::key_type>
+{
+	using key_type = typename C::key_type;
+
+	// The set to search
+	C *_container;
+
+public:
+
+	/*!
+	 * @brief Conversion constructor
+	 * @param container The set to search
+	 */
+	explicit KeyedIndexSparse(C &container) noexcept(true) : _container(&container) {
+	}
+
+	/*!
+	 * @brief Gets the whole set as a range
+	 * @return A range from the first component to the end
+	 */
+	virtual Range<T> All() const {
+
+		return MakeRange<T>(*_container);
+	}
+
+	/*!
+	 * @brief Looks up an id in the id table
+	 * @param key The id to look for
+	 * @return An iterator to the component, or the end of the range
+	 */
+	virtual Iterator<T> Find(const key_type &key) const {
+
+		return MakeIterator<T>(_container->find(key));
+	}
+
+	/*!
+	 * @brief Looks up an id in the id table, without making an iterator
+	 * @param key The id to look for
+	 * @return The address of the component, or nullptr
+	 */
+	virtual T *Lookup(const key_type &key) const {
+
+		const auto it = _container->find(key);
+		return it == _container->end() ? nullptr : &*it;
+	}
+
+	/*!
+	 * @brief Walks every component with its id, in packed order
+	 * @param visit Called with each id and component
+	 */
+	virtual void Walk(FunctionRef<void(const key_type &, T &)> visit) const {
+
+		std::size_t index = 0;
+		for (auto &component : *_container) {
+			visit(_container->IdAt(index++), component);
+		}
+	}
+
+	/*!
+	 * @brief Gets the number of components
+	 * @return The number of components
+	 */
+	virtual std::size_t Size() const {
+
+		return _container->size();
+	}
+};
+
+/*!
+ * @brief Creates a keyed range over a SparseSet
+ * @tparam T The base type (must be specified)
+ * @tparam C The SparseSet type (can be deduced)
+ * @param container The set to cover
+ * @return A KeyedRange that finds ids in constant time
+ */
+template<typename T, typename C>
+KeyedRange<T, typename C::key_type> MakeKeyedRangeSparse(C &container) {
+
+	return KeyedRange<T, typename C::key_type>(std::make_shared<KeyedIndexSparse<T, C>>(container));
+}
+
+#endif //TEMPL_ITERATOR_SPARSE_SET_H
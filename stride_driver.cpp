@@ -0,0 +1,133 @@
+/*!
+ * @file stride_driver.cpp
+ * @author Saadiq Daniels
+ * @date 18/10/2026
+ * @version 1.0
+ */
+
+#include <cstddef>
+#include <deque>
+#include <iostream>
+#include <list>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "iterator.h"
+#include "iterator_stride.h"
+#include "base.h"
+#include "benchmark.h"
+
+/*!
+ * Counts the elements that have been updated a number of times
+ * @param range The range to check
+ * @param calls The number of updates to look for
+ * @return The number of elements updated exactly calls times
+ */
+std::size_t CountCalls(const Range<base> &range, int calls) {
+
+	std::size_t count = 0;
+	ForEach(range, [&count, calls](base &rhs) {
+		count += static_cast<const derived4 &>(rhs).getCalls() == calls;
+	});
+	return count;
+}
+
+/*!
+ * Tests level of detail passes that update an eighth of each container
+ * @return 0, or 1 if an element was updated the wrong number of times
+ */
+int main() {
+
+	// Creating data //
+
+	const std::size_t count = 1 << 20;
+	const std::size_t stride = 8;
+	std::vector<derived4> derived4_vector;
+	std::deque<derived4> derived4_deque;
+	std::list<derived4> derived4_list;
+	std::vector<derived4 *> derived4_pointers;
+	derived4_vector.reserve(count);
+	for (std::size_t i = 0; i < count; ++i) {
+		derived4_vector.emplace_back(static_cast<float>(i % 100));
+		derived4_deque.emplace_back(static_cast<float>(i % 100));
+		derived4_list.emplace_back(static_cast<float>(i % 100));
+	}
+	for (derived4 &element : derived4_vector) {
+		derived4_pointers.push_back(&element);
+	}
+
+	const Range<base> ranges[] = {
+			MakeRange<base>(derived4_vector),
+			MakeRange<base>(derived4_deque),
+			MakeRange<base>(derived4_list),
+			Range<base>(MakeIteratorIndirect<base>(derived4_pointers.begin()),
+			            MakeIteratorIndirect<base>(derived4_pointers.end()))};
+	const std::string names[] = {"vector", "deque", "list", "vector of pointers"};
+
+	// Full passes against one eighth passes //
+
+	const auto update = [](base &rhs) {
+		rhs.doNothing();
+	};
+	std::mt19937 engine(42);
+	for (std::size_t i = 0; i < 4; ++i) {
+		double time = Benchmark(5, [&]() {
+			ForEach(ranges[i], update);
+		});
+		Report(names[i] + ", full pass", time, count, count * sizeof(derived4));
+
+		StridedRange<base> strided = MakeStridedRange(ranges[i], stride);
+		time = Benchmark(5, [&]() {
+			strided.ForEach(update);
+			strided.Rotate();
+		});
+		Report(names[i] + ", 1/8 strided pass", time, count / stride, count / stride * sizeof(derived4));
+
+		SampledRange<base> sampled = MakeSampledRange(ranges[i], count / stride);
+		time = Benchmark(5, [&]() {
+			sampled.ForEach(update, engine);
+		});
+		Report(names[i] + ", 1/8 sampled pass", time, count / stride, count / stride * sizeof(derived4));
+	}
+
+	// Every element is updated once by each run of stride rotated passes //
+
+	bool same = true;
+	std::list<derived4> small_list;
+	std::vector<derived4> small_vector;
+	for (int i = 0; i < 1000; ++i) {
+		small_list.emplace_back(static_cast<float>(i));
+		small_vector.emplace_back(static_cast<float>(i));
+	}
+	for (const Range<base> &range : {MakeRange<base>(small_list), MakeRange<base>(small_vector)}) {
+		StridedRange<base> strided = MakeStridedRange(range, 7, 3);
+		for (int pass = 0; pass < 7; ++pass) {
+			strided.ForEach(update);
+			strided.Rotate();
+		}
+		same = same && CountCalls(range, 1) == 1000;
+
+		// A sample visits each chosen element once, with the length given so
+		// the list is not counted first
+		SampledRange<base> sampled = MakeSampledRange(range, 100, small_list.size());
+		sampled.ForEach(update, engine);
+		same = same && CountCalls(range, 2) == 100 && CountCalls(range, 1) == 900;
+	}
+	// The length of a list is counted once, then kept until SetLength. With
+	// the old length of 1000 a sample of 1500 would visit every element.
+	SampledRange<base> grown = MakeSampledRange(MakeRange<base>(small_list), 1500);
+	grown.ForEach(update, engine);
+	for (int i = 0; i < 1000; ++i) {
+		small_list.emplace_back(static_cast<float>(i));
+	}
+	grown.SetLength(small_list.size());
+	std::size_t visited = 0;
+	grown.ForEach([&visited](base &) {
+		++visited;
+	}, engine);
+	same = same && visited == 1500;
+	std::cout << "Rotated strided passes and samples " << (same ? "match" : "do not match") << std::endl;
+
+	return same ? 0 : 1;
+}
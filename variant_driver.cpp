@@ -0,0 +1,146 @@
+/*!
+ * @file variant_driver.cpp
+ * @author Saadiq Daniels
+ * @date 18/10/2026
+ * @version 1.0
+ */
+
+#include <deque>
+#include <iostream>
+#include <list>
+#include <map>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "iterator.h"
+#include "iterator_variant.h"
+#include "base.h"
+#include "benchmark.h"
+
+// Every kind of container this build knows about
+using vector_iterator = std::vector<derived4>::iterator;
+using deque_iterator = std::deque<derived4>::iterator;
+using list_iterator = std::list<derived4>::iterator;
+using Variant = VariantIterator<base, vector_iterator, deque_iterator, list_iterator>;
+
+/*!
+ * Tests walking containers through a closed set of iterator types instead of Iterator<T>
+ * @return 0, or 1 if the walks do not agree
+ */
+int main() {
+
+	// Creating data //
+
+	const int count = 1 << 18;
+	std::vector<derived4> derived4_vector;
+	std::deque<derived4> derived4_deque;
+	std::list<derived4> derived4_list;
+	for (int i = 0; i < count; ++i) {
+		derived4_vector.emplace_back(static_cast<float>(i % 100));
+		derived4_deque.emplace_back(static_cast<float>(i % 100));
+		derived4_list.emplace_back(static_cast<float>(i % 100));
+	}
+
+	std::vector<Range<base>> ranges;
+	ranges.push_back(MakeRange<base>(derived4_vector));
+	ranges.push_back(MakeRange<base>(derived4_deque));
+	ranges.push_back(MakeRange<base>(derived4_list));
+
+	// Turning the type erased ranges into variant ranges at the boundary //
+	std::vector<std::pair<Variant, Variant>> variants;
+	for (const Range<base> &range : ranges) {
+		const std::optional<Variant> first = Variant::From(range.begin());
+		const std::optional<Variant> last = Variant::From(range.end());
+		if (!first || !last) {
+			std::cout << "Unknown container type" << std::endl;
+			return 1;
+		}
+		variants.emplace_back(*first, *last);
+	}
+	// A container that is not listed is reported, not turned into the first type
+	std::map<int, derived4> derived4_map;
+	const bool unknown = !Variant::From(MakeIteratorRight<base>(derived4_map.begin())) &&
+	                     !Variant::Holds(MakeIteratorRight<base>(derived4_map.begin()));
+	// A const range made from cbegin() hands its const_iterator back out
+	using const_vector_iterator = std::vector<derived4>::const_iterator;
+	const Iterator<const base> const_begin = MakeIterator<const base>(derived4_vector.cbegin());
+	const bool unwrapped = VariantIterator<const base, const_vector_iterator>::From(const_begin).has_value() &&
+	                       *const_begin.Native<const_vector_iterator>() == derived4_vector.cbegin();
+	// An end of another type is caught instead of read as the begin's type
+	std::size_t mismatched = 0;
+	auto count_mismatched = [&mismatched](base &) {
+		++mismatched;
+	};
+	const bool caught = !variants[0].first.Walk(variants[1].second, count_mismatched) && mismatched == 0;
+	// And back again
+	const Iterator<base> round_trip(static_cast<Iterator<base>>(variants[0].first));
+	std::cout << "Round trip: " << (round_trip == ranges[0].begin()) << std::endl;
+
+	// Benchmarking //
+
+	const int total = count * 3;
+	double sums[4] = {};
+
+	double time = Benchmark(5, [&]() {
+		double sum = 0.0;
+		for (const Range<base> &range : ranges) {
+			for (Iterator<base> it = range.begin(), end = range.end(); it != end; ++it) {
+				sum += it->getfloat();
+			}
+		}
+		sums[0] = sum;
+	});
+	Report("Iterator<base> loop", time, total, total * sizeof(derived4));
+
+	time = Benchmark(5, [&]() {
+		double sum = 0.0;
+		for (const Range<base> &range : ranges) {
+			ForEach(range, [&sum](const base &rhs) {
+				sum += rhs.getfloat();
+			});
+		}
+		sums[1] = sum;
+	});
+	Report("Iterator<base> ForEach", time, total, total * sizeof(derived4));
+
+#if defined(__GNUC__) && !defined(__clang__)
+	// GCC loses track of which type a copied variant holds, and warns that the
+	// other types' fields may be read uninitialized
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+	time = Benchmark(5, [&]() {
+		double sum = 0.0;
+		for (const std::pair<Variant, Variant> &range : variants) {
+			for (Variant it = range.first; it != range.second; ++it) {
+				sum += it->getfloat();
+			}
+		}
+		sums[2] = sum;
+	});
+	Report("VariantIterator loop", time, total, total * sizeof(derived4));
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+	time = Benchmark(5, [&]() {
+		double sum = 0.0;
+		for (const std::pair<Variant, Variant> &range : variants) {
+			ForEach(range.first, range.second, [&sum](const base &rhs) {
+				sum += rhs.getfloat();
+			});
+		}
+		sums[3] = sum;
+	});
+	Report("VariantIterator ForEach", time, total, total * sizeof(derived4));
+
+	KeepAlive(sums[0] + sums[1] + sums[2] + sums[3]);
+	if (sums[0] != sums[1] || sums[1] != sums[2] || sums[2] != sums[3] || !(round_trip == ranges[0].begin()) ||
+	    !unknown || !unwrapped || !caught) {
+		std::cout << "Sums do not match" << std::endl;
+		return 1;
+	}
+
+	return 0;
+}